@@ -0,0 +1,51 @@
+# Generate header with ProportionalFont from BDF font and add it to the target.
+#
+#   embedded_gfx_add_font(<target> NAME <name> BDF <file>
+#                         [FIRST <code>] [LAST <code>] [FALLBACK <code>] [KERNING <file>])
+#
+# The header is included as "<name>.hpp" and defines EmbeddedGfx::Fonts::<name>.
+# The font compiler is built with the project, when cross compiling it must be
+# built for the host and its path given in EMBEDDED_GFX_FONT_COMPILER.
+set(EMBEDDED_GFX_FONT_COMPILER "" CACHE FILEPATH "Path to font compiler built for the host")
+
+function(embedded_gfx_add_font TARGET)
+  cmake_parse_arguments(FONT "" "NAME;BDF;FIRST;LAST;FALLBACK;KERNING" "" ${ARGN})
+  if(NOT FONT_NAME OR NOT FONT_BDF)
+    message(FATAL_ERROR "embedded_gfx_add_font requires NAME and BDF")
+  endif()
+  if(EMBEDDED_GFX_FONT_COMPILER)
+    set(compiler ${EMBEDDED_GFX_FONT_COMPILER})
+  elseif(TARGET embedded-gfx-font-compiler)
+    set(compiler embedded-gfx-font-compiler)
+  else()
+    message(FATAL_ERROR "Font compiler is not available, enable EMBEDDED_GFX_BUILD_TOOLS or set EMBEDDED_GFX_FONT_COMPILER")
+  endif()
+
+  get_filename_component(bdf ${FONT_BDF} ABSOLUTE)
+  set(outputDir ${CMAKE_CURRENT_BINARY_DIR}/fonts)
+  set(output ${outputDir}/${FONT_NAME}.hpp)
+  set(arguments ${bdf} -o ${output} --name ${FONT_NAME})
+  set(dependencies ${bdf} ${compiler})
+  foreach(option FIRST LAST FALLBACK)
+    if(DEFINED FONT_${option})
+      string(TOLOWER ${option} flag)
+      list(APPEND arguments --${flag} ${FONT_${option}})
+    endif()
+  endforeach()
+  if(FONT_KERNING)
+    get_filename_component(kerning ${FONT_KERNING} ABSOLUTE)
+    list(APPEND arguments --kerning ${kerning})
+    list(APPEND dependencies ${kerning})
+  endif()
+
+  add_custom_command(
+    OUTPUT ${output}
+    COMMAND ${CMAKE_COMMAND} -E make_directory ${outputDir}
+    COMMAND ${compiler} ${arguments}
+    DEPENDS ${dependencies}
+    COMMENT "Generating font ${FONT_NAME} from ${FONT_BDF}"
+    VERBATIM
+  )
+  target_sources(${TARGET} PRIVATE ${output})
+  target_include_directories(${TARGET} PRIVATE ${outputDir})
+endfunction()
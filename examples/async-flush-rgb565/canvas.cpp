@@ -0,0 +1,186 @@
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <EmbeddedGfx/AsyncFlush.hpp>
+#include <EmbeddedGfx/BandCanvas.hpp>
+#include <EmbeddedGfx/Circle.hpp>
+#include <EmbeddedGfx/Line.hpp>
+#include <EmbeddedGfx/Rectangle.hpp>
+#include <EmbeddedGfx/Text.hpp>
+#include <EmbeddedGfx/Colors.hpp>
+
+using Clock = std::chrono::steady_clock;
+
+/**
+ * @brief Transport which simulates DMA transfer on a separate thread.
+ * Every pixel takes the given time, as on a real bus.
+ */
+template <size_t Width, size_t Height, typename PixelT>
+class MockTransport
+{
+  public:
+    MockTransport(const std::chrono::nanoseconds timePerPixel)
+      : timePerPixel_{timePerPixel}
+      , worker_{[this]() { run(); }}
+    {
+    }
+
+    ~MockTransport()
+    {
+      {
+        std::lock_guard<std::mutex> lock{mutex_};
+        stop_ = true;
+      }
+      condition_.notify_one();
+      worker_.join();
+    }
+
+    void beginTransfer(const PixelT* pixels, const size_t n, const EmbeddedGfx::TransferCallback callback)
+    {
+      {
+        std::lock_guard<std::mutex> lock{mutex_};
+        transfers_.push_back({pixels, n, callback});
+      }
+      condition_.notify_one();
+    }
+
+    /**
+     * @brief Start streaming a new frame from the top-left pixel.
+     */
+    void startFrame()
+    {
+      position_ = 0;
+    }
+
+    Clock::duration getBusyTime() const { return busyTime_; }
+
+    size_t getPosition() const { return position_; }
+
+  private:
+    struct Transfer
+    {
+      const PixelT* pixels;
+      size_t n;
+      EmbeddedGfx::TransferCallback callback;
+    };
+
+    void run()
+    {
+      std::unique_lock<std::mutex> lock{mutex_};
+      while(true)
+      {
+        condition_.wait(lock, [this]() { return stop_ || !transfers_.empty(); });
+        if(transfers_.empty()) return;
+        const Transfer transfer = transfers_.front();
+        transfers_.pop_front();
+        lock.unlock();
+        const auto start = Clock::now();
+        for(size_t i = 0; i < transfer.n && position_ < Width * Height; ++i, ++position_)
+        {
+          frame_[position_ / Width][position_ % Width] = transfer.pixels[i];
+        }
+        std::this_thread::sleep_until(start + timePerPixel_ * transfer.n);
+        busyTime_ += Clock::now() - start;
+        transfer.callback();
+        lock.lock();
+      }
+    }
+
+    const std::chrono::nanoseconds timePerPixel_;
+    std::array<std::array<PixelT, Width>, Height> frame_{};
+    size_t position_ = 0;
+    Clock::duration busyTime_{};
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    std::deque<Transfer> transfers_;
+    bool stop_ = false;
+    std::thread worker_;
+};
+
+/**
+ * @brief Display for band canvas which waits for every
+ * transfer to finish, as without the pipeline.
+ */
+template <typename FlushT>
+struct SerializedDisplay
+{
+  using BufferT = typename FlushT::BufferT;
+  FlushT& flush;
+
+  auto* acquire() { return flush.acquire(); }
+
+  void submit(const size_t length)
+  {
+    flush.submit(length);
+    flush.waitIdle();
+  }
+};
+
+int main()
+{
+  using namespace EmbeddedGfx;
+  static constexpr size_t height = 240;
+  static constexpr size_t width = 320;
+  static constexpr size_t bandHeight = 16;
+  // 16-bit pixels over 40 MHz SPI take 400 ns each
+  using TransportT = MockTransport<width, height, RGB565::Type>;
+  TransportT transport{std::chrono::nanoseconds{400}};
+  AsyncFlush<RGB565::Type, width * bandHeight, TransportT> flush{transport};
+
+  // the bands are drawn right into the buffers of the flush
+  BandCanvas<width, height, bandHeight, CanvasType::Normal, RGB565, 64, true> canvas;
+  using CanvasT = decltype(canvas);
+
+  // gauge-like scene
+  std::array<Circle<CanvasT>, 48> circles;
+  for(size_t i = 0; i < circles.size(); ++i)
+  {
+    circles[i] = Circle<CanvasT>({20.0f + (i % 8) * 40.0f, 20.0f + (i / 8) * 40.0f}, 18.0f);
+    circles[i].setFillColor((i % 2) ? Colors::Blue : Colors::Cyan);
+    circles[i].setOutlineColor(Colors::White);
+    canvas.add(circles[i]);
+  }
+  std::array<Line<CanvasT>, 8> needles;
+  for(size_t i = 0; i < needles.size(); ++i)
+  {
+    needles[i] = Line<CanvasT>({20.0f + i * 40.0f, 20.0f}, {5.0f + i * 40.0f, 230.0f}, Colors::Red);
+    canvas.add(needles[i]);
+  }
+  Rectangle<CanvasT> bar{{0.0f, 228.0f}, 320.0f, 12.0f};
+  bar.setFillColor(Colors::Green);
+  canvas.add(bar);
+  Text<32, Font<6, 8>, CanvasT> text("Async flush", {4.0f, 230.0f});
+  text.setColor(Colors::Black);
+  canvas.add(text);
+  canvas.clear(Colors::Black);
+
+  static constexpr int frames = 10;
+  const auto measure = [&](auto& display) {
+    const auto start = Clock::now();
+    for(int frame = 0; frame < frames; ++frame)
+    {
+      flush.waitIdle();
+      transport.startFrame();
+      canvas.render(display);
+    }
+    flush.waitIdle();
+    return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start).count() / frames;
+  };
+
+  SerializedDisplay<decltype(flush)> serialized{flush};
+  const auto serializedTime = measure(serialized);
+  const auto busyBefore = transport.getBusyTime();
+  const auto pipelinedTime = measure(flush);
+  const auto transferTime = std::chrono::duration_cast<std::chrono::microseconds>(
+                              transport.getBusyTime() - busyBefore).count() / frames;
+
+  std::cout << "Pixels per frame: " << transport.getPosition() << "\n"
+            << "Transfer time per frame: " << transferTime << " us\n"
+            << "Serialized frame time: " << serializedTime << " us\n"
+            << "Pipelined frame time: " << pipelinedTime << " us\n"
+            << "Drawing hidden behind transfers: " << (serializedTime - pipelinedTime) << " us" << std::endl;
+}
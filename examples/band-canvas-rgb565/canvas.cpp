@@ -0,0 +1,119 @@
+#include <array>
+#include <iostream>
+#include <EmbeddedGfx/BandCanvas.hpp>
+#include <EmbeddedGfx/Line.hpp>
+#include <EmbeddedGfx/Ellipse.hpp>
+#include <EmbeddedGfx/Circle.hpp>
+#include <EmbeddedGfx/Polygon.hpp>
+#include <EmbeddedGfx/Triangle.hpp>
+#include <EmbeddedGfx/Rectangle.hpp>
+#include <EmbeddedGfx/Text.hpp>
+#include <EmbeddedGfx/Colors.hpp>
+
+template <typename ColorT>
+char colorToChar(const typename ColorT::Type color)
+{
+  if(color == static_cast<ColorT>(EmbeddedGfx::Colors::White).getValue()) return 'W';
+  if(color == static_cast<ColorT>(EmbeddedGfx::Colors::Black).getValue()) return ' ';
+  if(color == static_cast<ColorT>(EmbeddedGfx::Colors::Blue).getValue()) return 'B';
+  if(color == static_cast<ColorT>(EmbeddedGfx::Colors::Red).getValue()) return 'R';
+  if(color == static_cast<ColorT>(EmbeddedGfx::Colors::Green).getValue()) return 'G';
+  if(color == static_cast<ColorT>(EmbeddedGfx::Colors::Yellow).getValue()) return 'Y';
+  if(color == static_cast<ColorT>(EmbeddedGfx::Colors::Cyan).getValue()) return 'C';
+  if(color == static_cast<ColorT>(EmbeddedGfx::Colors::Magenta).getValue()) return 'M';
+  return 'X';
+}
+
+/**
+ * @brief Display which receives the canvas band by band.
+ * It keeps the whole frame only to be able to print it.
+ */
+template<size_t Width, size_t Height, typename ColorT>
+class VirtualDisplay
+{
+  public:
+    template <typename MatrixT>
+    void writeBand(const size_t y, const size_t rows, const MatrixT& band)
+    {
+      for(size_t row = 0; row < rows; ++row)
+      {
+        frame_[y + row] = band[row];
+      }
+      ++transfers_;
+    }
+
+    void print() const
+    {
+      for(size_t x = 0; x < Width + 2; ++x) std::cout << "-";
+      std::cout << "\n";
+      for(size_t y = 0; y < Height; ++y)
+      {
+        std::cout << "|";
+        for(size_t x = 0; x < Width; ++x)
+        {
+          std::cout << colorToChar<ColorT>(frame_[y][x]);
+        }
+        std::cout << "| \n";
+      }
+      for(size_t x = 0; x < Width + 2; ++x) std::cout << "-";
+      std::cout << "\nTransfers: " << transfers_ << std::endl;
+    }
+  private:
+    std::array<std::array<typename ColorT::Type, Width>, Height> frame_{};
+    size_t transfers_ = 0;
+};
+
+int main()
+{
+  using namespace EmbeddedGfx;
+  static constexpr size_t height = 64;
+  static constexpr size_t width = 128;
+  static constexpr size_t bandHeight = 16;
+  VirtualDisplay<width, height, RGB565> virtualDisplay;
+  // only 16 rows are held in memory
+  BandCanvas<width, height, bandHeight, CanvasType::Normal, RGB565, 8> canvas;
+  using CanvasT = decltype(canvas);
+
+  // Line test
+  Line<CanvasT> line{{1, 2}, {20, 10}, Colors::Blue};
+  canvas.add(line);
+
+  // Ellipse test
+  Ellipse<CanvasT> ellipse{{30, 30}, 10, 5};
+  ellipse.setOutlineColor(Colors::Red);
+  ellipse.setFillColor(Colors::Cyan);
+  canvas.add(ellipse);
+
+  // Circle test
+  Circle<CanvasT> circle({60, 20}, 10);
+  circle.setOutlineColor(Colors::White);
+  canvas.add(circle);
+
+  // Polygon test
+  Polygon<4, CanvasT> polygon({{{90.0f, 30.0f}, {110.0f, 30.0f}, {100.0f, 50.0f}, {60.0f, 50.0f}}});
+  polygon.setOutlineColor(Colors::Green);
+  polygon.setFillColor(Colors::Red);
+  canvas.add(polygon);
+
+  // Triangle test
+  Triangle<CanvasT> triangle({{{60.0f, 60.0f}, {50.0f, 50.0f}, {50.0f, 60.0f}}});
+  triangle.setOutlineColor(Colors::White);
+  canvas.add(triangle);
+
+  // Rectangle test
+  Rectangle<CanvasT> rectangle{{10.0f, 50.0f}, 20.0f, 10.0f};
+  rectangle.setOutlineColor(Colors::White);
+  canvas.add(rectangle);
+
+  // Text test
+  Text<100, Font<6, 8>, CanvasT> text("Text test !!!", {30.0f, 0.0f});
+  text.setColor(Colors::Yellow);
+  canvas.add(text);
+
+  // draw the scene band by band and send the bands to the display
+  canvas.clear(Colors::Black);
+  canvas.render(virtualDisplay);
+
+  // print the display in the console
+  virtualDisplay.print();
+}
@@ -59,7 +59,7 @@ int main()
   canvas.draw(circle);
 
   // Polygon test
-  Polygon<4, CanvasT> polygon({{{90.0f, 30.0f}, {100.0f, 50.0f}, {60.0f, 50.0f}, {110.0f, 30.0f}}});
+  Polygon<4, CanvasT> polygon({{{90.0f, 30.0f}, {110.0f, 30.0f}, {100.0f, 50.0f}, {60.0f, 50.0f}}});
   polygon.setOutlineColor(Colors::White);
   canvas.draw(polygon);
 
@@ -81,6 +81,22 @@ int main()
   // print the canvas in the console
   printCanvas(canvas);
 
+  // the extreme points of the bounding box must be plotted,
+  // also for flat ellipses
+  bool extremes = true;
+  for(int b = 1; b <= 3; ++b)
+  {
+    CanvasT flat;
+    Ellipse<CanvasT, int> flatEllipse{64, 32, 19, b};
+    flatEllipse.setOutlineColor(Colors::White);
+    flat.draw(flatEllipse);
+    const Rect bounds = flatEllipse.getBounds();
+    const auto& matrix = flat.getMatrix();
+    extremes = extremes && matrix[32][bounds.x0] && matrix[32][bounds.x1 - 1]
+                        && matrix[bounds.y0][64] && matrix[bounds.y1 - 1][64];
+  }
+  std::cout << "Ellipse extremes plotted: " << (extremes ? "yes" : "no") << std::endl;
+
   // clear the canvas
   canvas.clear(Colors::Black);
   printCanvas(canvas);
@@ -0,0 +1,83 @@
+#include <iostream>
+#include <EmbeddedGfx/BufferedCanvas.hpp>
+#include <EmbeddedGfx/Line.hpp>
+#include <EmbeddedGfx/Circle.hpp>
+#include <EmbeddedGfx/Rectangle.hpp>
+#include <EmbeddedGfx/Text.hpp>
+#include <EmbeddedGfx/Colors.hpp>
+
+template <typename CanvasT>
+void printCanvas(const CanvasT& canvas)
+{
+  auto rows = canvas.getHeight();
+  auto columns = canvas.getWidth();
+  const auto& matrix = canvas.getMatrix();
+  for(size_t x = 0; x < columns+2; ++x)
+  {
+    std::cout << "-";
+  }
+  std::cout << "\n";
+  for(size_t y = 0; y < rows; ++y)
+  {
+    std::cout << "|";
+    for(size_t x = 0; x < columns; ++x)
+    {
+      std::cout << ((matrix[y][x]) ? 'X' : ' ');
+    }
+    std::cout << "| \n";
+  }
+  for(size_t x = 0; x < columns+2; ++x)
+  {
+    std::cout << "-";
+  }
+  std::cout << std::endl;
+}
+
+int main()
+{
+  using namespace EmbeddedGfx;
+  static constexpr size_t height = 64;
+  static constexpr size_t width = 128;
+  BufferedCanvas<width, height, CanvasType::Normal, BlackAndWhite> canvas;
+  using CanvasT = decltype(canvas);
+
+  // huge circle, only a small arc of it is on the canvas
+  Circle<CanvasT> horizon({64, 1000}, 960);
+  horizon.setOutlineColor(Colors::White);
+  canvas.draw(horizon);
+
+  // scroll view: the window frame and its content, scrolled 20 pixels
+  // to the left and 4 pixels up, clipped to the inside of the frame
+  Rectangle<CanvasT> frame{{8.0f, 8.0f}, 60.0f, 30.0f};
+  frame.setOutlineColor(Colors::White);
+  canvas.draw(frame);
+  const int scrollX = -20;
+  const int scrollY = -4;
+  canvas.pushClip(Rect{9, 9, 68, 38});
+  {
+    Text<32, Font<6, 8>, CanvasT> line1("Scrolled text view", {10.0f + scrollX, 12.0f + scrollY});
+    line1.setColor(Colors::White);
+    canvas.draw(line1);
+    Text<32, Font<6, 8>, CanvasT> line2("with signed coords", {10.0f + scrollX, 22.0f + scrollY});
+    line2.setColor(Colors::White);
+    canvas.draw(line2);
+
+    // nested clip: the diagonal is drawn only in the right half of the view
+    canvas.pushClip(Rect{40, 0, 128, 64});
+    Line<CanvasT> diagonal{{0, 0}, {127, 63}, Colors::White};
+    canvas.draw(diagonal);
+    canvas.popClip();
+  }
+  canvas.popClip();
+
+  // shapes at negative coordinates are clipped, not wrapped around
+  Rectangle<CanvasT> corner{{-10.0f, 50.0f}, 20.0f, 20.0f};
+  corner.setFillColor(Colors::White);
+  canvas.draw(corner);
+  Text<32, Font<6, 8>, CanvasT> cut("Edge", {-9.0f, 42.0f});
+  cut.setColor(Colors::White);
+  canvas.draw(cut);
+
+  // print the canvas in the console
+  printCanvas(canvas);
+}
@@ -0,0 +1,89 @@
+#include <array>
+#include <iostream>
+#include <EmbeddedGfx/BufferedCanvas.hpp>
+#include <EmbeddedGfx/Bitmap.hpp>
+#include <EmbeddedGfx/Circle.hpp>
+#include <EmbeddedGfx/Rectangle.hpp>
+#include <EmbeddedGfx/Text.hpp>
+#include <EmbeddedGfx/Colors.hpp>
+
+template <typename CanvasT>
+void printCanvas(const CanvasT& canvas)
+{
+  auto rows = canvas.getHeight();
+  auto columns = canvas.getWidth();
+  for(size_t x = 0; x < columns+2; ++x)
+  {
+    std::cout << "-";
+  }
+  std::cout << "\n";
+  for(size_t y = 0; y < rows; ++y)
+  {
+    std::cout << "|";
+    for(size_t x = 0; x < columns; ++x)
+    {
+      std::cout << ((canvas.getPixel(x, y)) ? 'X' : ' ');
+    }
+    std::cout << "| \n";
+  }
+  for(size_t x = 0; x < columns+2; ++x)
+  {
+    std::cout << "-";
+  }
+  std::cout << std::endl;
+}
+
+// radial gradient, bright in the center
+template <size_t Size>
+constexpr std::array<std::array<uint8_t, Size>, Size> makeGradient()
+{
+  std::array<std::array<uint8_t, Size>, Size> image{};
+  constexpr int center = Size / 2;
+  for(int y = 0; y < static_cast<int>(Size); ++y)
+  {
+    for(int x = 0; x < static_cast<int>(Size); ++x)
+    {
+      const int distanceSquared = (x - center) * (x - center) + (y - center) * (y - center);
+      const int intensity = 255 - distanceSquared * 255 / (2 * center * center);
+      image[y][x] = static_cast<uint8_t>(intensity < 0 ? 0 : intensity);
+    }
+  }
+  return image;
+}
+
+int main()
+{
+  using namespace EmbeddedGfx;
+  static constexpr size_t height = 64;
+  static constexpr size_t width = 128;
+  BufferedCanvas<width, height, CanvasType::Page, Dithered> canvas;
+  using CanvasT = decltype(canvas);
+
+  // gray scale from black to white
+  static constexpr size_t bars = 8;
+  for(size_t i = 0; i < bars; ++i)
+  {
+    const auto gray = static_cast<uint8_t>(i * 255 / (bars - 1));
+    Rectangle<CanvasT> bar{{i * 8.0f, 0.0f}, 8.0f, 24.0f};
+    bar.setFillColor(Color{gray, gray, gray});
+    canvas.draw(bar);
+  }
+
+  // gauge filled with gray
+  Circle<CanvasT> gauge({90, 40}, 20);
+  gauge.setFillColor(Color{96, 96, 96});
+  gauge.setOutlineColor(Colors::White);
+  canvas.draw(gauge);
+
+  // error diffusion for images
+  static constexpr auto gradient = makeGradient<32>();
+  GrayBitmap<32, 32, CanvasT> bitmap(gradient, {10.0f, 28.0f});
+  canvas.draw(bitmap);
+
+  Text<16, Font<6, 8>, CanvasT> text("Dither", {70.0f, 4.0f});
+  text.setColor(Colors::White);
+  canvas.draw(text);
+
+  // print the canvas in the console
+  printCanvas(canvas);
+}
@@ -0,0 +1,96 @@
+#include <iostream>
+#include <EmbeddedGfx/BufferedCanvas.hpp>
+#include <EmbeddedGfx/Line.hpp>
+#include <EmbeddedGfx/Ellipse.hpp>
+#include <EmbeddedGfx/Circle.hpp>
+#include <EmbeddedGfx/Polygon.hpp>
+#include <EmbeddedGfx/Triangle.hpp>
+#include <EmbeddedGfx/Rectangle.hpp>
+#include <EmbeddedGfx/Text.hpp>
+#include <EmbeddedGfx/Colors.hpp>
+
+template <typename CanvasT>
+void printCanvas(const CanvasT& canvas)
+{
+  auto rows = canvas.getHeight();
+  auto columns = canvas.getWidth();
+  const auto& matrix = canvas.getMatrix();
+  for(size_t x = 0; x < columns+2; ++x)
+  {
+    std::cout << "-";
+  }
+  std::cout << "\n";
+  for(size_t y = 0; y < rows; ++y)
+  {
+    std::cout << "|";
+    for(size_t x = 0; x < columns; ++x)
+    {
+      std::cout << ((matrix[y][x]) ? 'X' : ' ');
+    }
+    std::cout << "| \n";
+  }
+  for(size_t x = 0; x < columns+2; ++x)
+  {
+    std::cout << "-";
+  }
+  std::cout << std::endl;
+}
+
+/**
+ * @brief Set the outline color of the shape, usable in constant expressions.
+ */
+template <typename ShapeT>
+constexpr ShapeT outlined(ShapeT shape)
+{
+  shape.setOutlineColor(EmbeddedGfx::Colors::White);
+  return shape;
+}
+
+int main()
+{
+  using namespace EmbeddedGfx;
+  static constexpr size_t height = 64;
+  static constexpr size_t width = 128;
+  BufferedCanvas<width, height, CanvasType::Normal, BlackAndWhite> canvas;
+  using CanvasT = decltype(canvas);
+  // 24.8 fixed-point coordinates, rasterized without floating point
+  using CoordT = Q24_8;
+  using PointT = Vector2D<CoordT>;
+  // half a pixel, rounded away from zero like std::lround
+  constexpr CoordT half = CoordT::fromRaw(CoordT::One / 2);
+
+  // the layout is static, so the shapes, including the edge table
+  // of the polygons, are built at compile time and kept in flash
+  static constexpr Line<CanvasT, CoordT> line{PointT{1, 2}, PointT{20, 10}, Colors::White};
+  static constexpr auto ellipse = outlined(Ellipse<CanvasT, CoordT>{PointT{30, 30}, 10, 5});
+  static constexpr auto circle = outlined(Circle<CanvasT, CoordT>{PointT{60, 20}, CoordT{10} - half});
+  static constexpr auto polygon = outlined(Polygon<4, CanvasT, CoordT>{{{{90, 30}, {110, 30}, {100, 50}, {60, 50}}}});
+  static constexpr auto triangle = outlined(Triangle<CanvasT, CoordT>{{{{60, 60}, {50, 50}, {50, 60}}}});
+  static constexpr auto rectangle = outlined(Rectangle<CanvasT, CoordT>{PointT{10, 50}, 20, 10});
+
+  // Line test
+  canvas.draw(line);
+
+  // Ellipse test
+  canvas.draw(ellipse);
+
+  // Circle test
+  canvas.draw(circle);
+
+  // Polygon test
+  canvas.draw(polygon);
+
+  // Triangle test
+  canvas.draw(triangle);
+
+  // Rectangle test
+  canvas.draw(rectangle);
+
+  // Text test
+  Text<100, Font<6, 8>, CanvasT, CoordT> text("Text test !!!", PointT{30, 0});
+  text.setColor(Colors::White);
+  canvas.draw(text);
+
+  // print the canvas in the console
+  printCanvas(canvas);
+}
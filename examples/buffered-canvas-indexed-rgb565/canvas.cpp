@@ -0,0 +1,144 @@
+#include <array>
+#include <iostream>
+#include <EmbeddedGfx/AsyncFlush.hpp>
+#include <EmbeddedGfx/BufferedCanvas.hpp>
+#include <EmbeddedGfx/Palette.hpp>
+#include <EmbeddedGfx/Line.hpp>
+#include <EmbeddedGfx/Ellipse.hpp>
+#include <EmbeddedGfx/Circle.hpp>
+#include <EmbeddedGfx/Polygon.hpp>
+#include <EmbeddedGfx/Triangle.hpp>
+#include <EmbeddedGfx/Rectangle.hpp>
+#include <EmbeddedGfx/Text.hpp>
+#include <EmbeddedGfx/Colors.hpp>
+
+// indices of the colors in the palette
+enum PaletteIndex : uint8_t
+{
+  Background,
+  White,
+  Red,
+  Green,
+  Blue,
+  Yellow,
+  Cyan,
+  Magenta
+};
+
+/**
+ * @brief Display which receives RGB565 pixels row by row
+ * and completes every transfer immediately.
+ */
+template <size_t Width, size_t Height>
+class VirtualDisplay
+{
+  public:
+    void beginTransfer(const uint16_t* pixels, const size_t n, const EmbeddedGfx::TransferCallback callback)
+    {
+      for(size_t i = 0; i < n && position_ < Width * Height; ++i, ++position_)
+      {
+        frame_[position_ / Width][position_ % Width] = pixels[i];
+      }
+      callback();
+    }
+
+    void print() const
+    {
+      const auto encode = [](const EmbeddedGfx::Color& color) {
+        return EmbeddedGfx::RGB565{color}.getValue();
+      };
+      namespace Colors = EmbeddedGfx::Colors;
+      const std::array<std::pair<uint16_t, char>, 8> names{{
+          {encode(Colors::Black), ' '}, {encode(Colors::White), 'W'}
+        , {encode(Colors::Red), 'R'}, {encode(Colors::Green), 'G'}
+        , {encode(Colors::Blue), 'B'}, {encode(Colors::Yellow), 'Y'}
+        , {encode(Colors::Cyan), 'C'}, {encode(Colors::Magenta), 'M'}}};
+      for(size_t x = 0; x < Width+2; ++x)
+      {
+        std::cout << "-";
+      }
+      std::cout << "\n";
+      for(size_t y = 0; y < Height; ++y)
+      {
+        std::cout << "|";
+        for(size_t x = 0; x < Width; ++x)
+        {
+          char name = 'X';
+          for(const auto& [value, character]: names)
+          {
+            if(frame_[y][x] == value) name = character;
+          }
+          std::cout << name;
+        }
+        std::cout << "| \n";
+      }
+      for(size_t x = 0; x < Width+2; ++x)
+      {
+        std::cout << "-";
+      }
+      std::cout << std::endl;
+    }
+  private:
+    std::array<std::array<uint16_t, Width>, Height> frame_{};
+    size_t position_ = 0;
+};
+
+int main()
+{
+  using namespace EmbeddedGfx;
+  static constexpr size_t height = 64;
+  static constexpr size_t width = 128;
+  // two pixels per byte
+  BufferedCanvas<width, height, CanvasType::PackedMsbFirst, Indexed<4>> canvas;
+  using CanvasT = decltype(canvas);
+  static constexpr Palette<RGB565, 16> palette{{
+      Colors::Black, Colors::White, Colors::Red, Colors::Green
+    , Colors::Blue, Colors::Yellow, Colors::Cyan, Colors::Magenta}};
+
+  // Line test
+  Line<CanvasT> line{{1, 2}, {20, 10}, Blue};
+  canvas.draw(line);
+
+  // Ellipse test
+  Ellipse<CanvasT> ellipse{{30, 30}, 10, 5};
+  ellipse.setOutlineColor(Red);
+  ellipse.setFillColor(Cyan);
+  canvas.draw(ellipse);
+
+  // Circle test
+  Circle<CanvasT> circle({60, 20}, 10);
+  circle.setOutlineColor(White);
+  canvas.draw(circle);
+
+  // Polygon test
+  Polygon<4, CanvasT> polygon({{{90.0f, 30.0f}, {110.0f, 30.0f}, {100.0f, 50.0f}, {60.0f, 50.0f}}});
+  polygon.setOutlineColor(Green);
+  polygon.setFillColor(Red);
+  canvas.draw(polygon);
+
+  // Triangle test
+  Triangle<CanvasT> triangle({{{60.0f, 60.0f}, {50.0f, 50.0f}, {50.0f, 60.0f}}});
+  triangle.setOutlineColor(White);
+  canvas.draw(triangle);
+
+  // Rectangle test
+  Rectangle<CanvasT> rectangle{{10.0f, 50.0f}, 20.0f, 10.0f};
+  rectangle.setOutlineColor(White);
+  rectangle.setFillColor(Magenta);
+  canvas.draw(rectangle);
+
+  // Text test
+  Text<100, Font<6, 8>, CanvasT> text("Text test !!!", {30.0f, 0.0f});
+  text.setColor(Yellow);
+  canvas.draw(text);
+
+  // the indices are expanded to RGB565 one row at a time
+  VirtualDisplay<width, height> display;
+  AsyncFlush<RGB565::Type, width, decltype(display)> flush{display};
+  flush.flush(canvas, palette);
+  display.print();
+
+  std::cout << "Indexed matrix: " << sizeof(CanvasT::MatrixT) << " bytes\n"
+            << "RGB565 matrix: " << sizeof(BufferedCanvas<width, height, CanvasType::Normal, RGB565>::MatrixT)
+            << " bytes" << std::endl;
+}
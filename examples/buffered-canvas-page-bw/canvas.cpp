@@ -36,6 +36,22 @@ void printCanvas(const CanvasT& canvas)
   std::cout << std::endl;
 }
 
+template <typename CanvasT>
+void printDirtyPages(const CanvasT& canvas)
+{
+  std::cout << "Dirty pages:\n";
+  for(const auto& run: canvas.getDirtyPages())
+  {
+    std::cout << "  page: " << run.page << ", columns: " << run.columnStart
+              << "-" << run.columnEnd << ", bytes:";
+    for(size_t i = 0; i < run.getLength(); ++i)
+    {
+      std::cout << " " << static_cast<int>(run.bytes[i]);
+    }
+    std::cout << "\n";
+  }
+}
+
 int main()
 {
   using namespace EmbeddedGfx;
@@ -59,7 +75,7 @@ int main()
   canvas.draw(circle);
 
   // Polygon test
-  Polygon<4, CanvasT> polygon({{{90.0f, 30.0f}, {100.0f, 50.0f}, {60.0f, 50.0f}, {110.0f, 30.0f}}});
+  Polygon<4, CanvasT> polygon({{{90.0f, 30.0f}, {110.0f, 30.0f}, {100.0f, 50.0f}, {60.0f, 50.0f}}});
   polygon.setOutlineColor(Colors::White);
   canvas.draw(polygon);
 
@@ -80,4 +96,10 @@ int main()
 
   // print the canvas in the console
   printCanvas(canvas);
+
+  // only the changed bytes of each page need to be sent to the display
+  canvas.clearDirtyRegion();
+  text.setString("Text test ???");
+  canvas.draw(text);
+  printDirtyPages(canvas);
 }
\ No newline at end of file
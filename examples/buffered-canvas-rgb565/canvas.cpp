@@ -78,6 +78,17 @@ void printCanvas(const CanvasT& canvas)
   std::cout << std::endl;
 }
 
+template <typename CanvasT>
+void printDirtyRegion(const CanvasT& canvas)
+{
+  std::cout << "Dirty region:\n";
+  for(const auto& rect: canvas.getDirtyRegion())
+  {
+    std::cout << "  x: " << rect.x0 << ", y: " << rect.y0
+              << ", w: " << rect.getWidth() << ", h: " << rect.getHeight() << "\n";
+  }
+}
+
 int main()
 {
   using namespace EmbeddedGfx;
@@ -102,7 +113,7 @@ int main()
   canvas.draw(circle);
 
   // Polygon test
-  Polygon<4, CanvasT> polygon({{{90.0f, 30.0f}, {100.0f, 50.0f}, {60.0f, 50.0f}, {110.0f, 30.0f}}});
+  Polygon<4, CanvasT> polygon({{{90.0f, 30.0f}, {110.0f, 30.0f}, {100.0f, 50.0f}, {60.0f, 50.0f}}});
   polygon.setOutlineColor(Colors::Green);
   polygon.setFillColor(Colors::Red);
   canvas.draw(polygon);
@@ -124,4 +135,11 @@ int main()
 
   // print the canvas in the console
   printCanvas(canvas);
+
+  // only the changed areas need to be sent to the display
+  canvas.clearDirtyRegion();
+  Rectangle<CanvasT> digit{{90.0f, 2.0f}, 6.0f, 8.0f};
+  digit.setFillColor(Colors::Magenta);
+  canvas.draw(digit);
+  printDirtyRegion(canvas);
 }
\ No newline at end of file
@@ -0,0 +1,80 @@
+#include <iostream>
+#include <EmbeddedGfx/BufferedCanvas.hpp>
+#include <EmbeddedGfx/Line.hpp>
+#include <EmbeddedGfx/Ellipse.hpp>
+#include <EmbeddedGfx/Circle.hpp>
+#include <EmbeddedGfx/Polygon.hpp>
+#include <EmbeddedGfx/Triangle.hpp>
+#include <EmbeddedGfx/Rectangle.hpp>
+#include <EmbeddedGfx/Text.hpp>
+#include <EmbeddedGfx/Colors.hpp>
+
+// prints the matrix as it is sent to the display, in its native orientation
+template <typename CanvasT>
+void printMatrix(const CanvasT& canvas)
+{
+  const auto& matrix = canvas.getMatrix();
+  auto rows = CanvasT::NativeHeight;
+  auto columns = CanvasT::NativeWidth;
+  for(size_t x = 0; x < columns+2; ++x)
+  {
+    std::cout << "-";
+  }
+  std::cout << "\n";
+  for(size_t y = 0; y < rows; ++y)
+  {
+    std::cout << "|";
+    for(size_t x = 0; x < columns; ++x)
+    {
+      std::cout << ((matrix[y][x]) ? 'X' : ' ');
+    }
+    std::cout << "| \n";
+  }
+  for(size_t x = 0; x < columns+2; ++x)
+  {
+    std::cout << "-";
+  }
+  std::cout << std::endl;
+}
+
+int main()
+{
+  using namespace EmbeddedGfx;
+  // portrait canvas on a landscape 128x64 display mounted at 90 degrees
+  static constexpr size_t height = 128;
+  static constexpr size_t width = 64;
+  BufferedCanvas<width, height, CanvasType::Normal, BlackAndWhite, Orientation<Rotation::Rotate90>> canvas;
+  using CanvasT = decltype(canvas);
+
+  // Line test
+  Line<CanvasT> line{{1, 2}, {20, 10}, Colors::White};
+  canvas.draw(line);
+
+  // Ellipse test
+  Ellipse<CanvasT> ellipse{{30, 30}, 10, 5};
+  ellipse.setOutlineColor(Colors::White);
+  canvas.draw(ellipse);
+
+  // Circle test
+  Circle<CanvasT> circle({40, 60}, 10);
+  circle.setFillColor(Colors::White);
+  canvas.draw(circle);
+
+  // Triangle test
+  Triangle<CanvasT> triangle({{{20.0f, 100.0f}, {10.0f, 90.0f}, {10.0f, 100.0f}}});
+  triangle.setOutlineColor(Colors::White);
+  canvas.draw(triangle);
+
+  // Rectangle test
+  Rectangle<CanvasT> rectangle{{30.0f, 90.0f}, 20.0f, 30.0f};
+  rectangle.setOutlineColor(Colors::White);
+  canvas.draw(rectangle);
+
+  // Text test
+  Text<100, Font<6, 8>, CanvasT> text("Rotated", {10.0f, 75.0f});
+  text.setColor(Colors::White);
+  canvas.draw(text);
+
+  // print the matrix in the console
+  printMatrix(canvas);
+}
@@ -0,0 +1,66 @@
+#include <iostream>
+#include <EmbeddedGfx/BufferedCanvas.hpp>
+#include <EmbeddedGfx/Text.hpp>
+#include <EmbeddedGfx/Colors.hpp>
+#include "Gauge16.hpp"
+
+template <typename CanvasT>
+void printCanvas(const CanvasT& canvas)
+{
+  auto rows = canvas.getHeight();
+  auto columns = canvas.getWidth();
+  const auto& matrix = canvas.getMatrix();
+  for(size_t x = 0; x < columns+2; ++x)
+  {
+    std::cout << "-";
+  }
+  std::cout << "\n";
+  for(size_t y = 0; y < rows; ++y)
+  {
+    std::cout << "|";
+    for(size_t x = 0; x < columns; ++x)
+    {
+      std::cout << ((matrix[y/CanvasT::PageSize][x] & (1 << (y % CanvasT::PageSize))) ? 'X' : ' ');
+    }
+    std::cout << "| \n";
+  }
+  for(size_t x = 0; x < columns+2; ++x)
+  {
+    std::cout << "-";
+  }
+  std::cout << std::endl;
+}
+
+int main()
+{
+  using namespace EmbeddedGfx;
+  static constexpr size_t height = 48;
+  static constexpr size_t width = 128;
+  using CanvasT = BufferedCanvas<width, height, CanvasType::Page, BlackAndWhite>;
+  CanvasT canvas;
+  canvas.clear(Colors::Black);
+
+  // the proportional font only stores the columns with pixels,
+  // the narrow characters like 1 and . take less space
+  Text<16, Font<6, 8>, CanvasT> label("RPM", {2, 0});
+  label.setColor(Colors::White);
+  Text<16, Fonts::Gauge16, CanvasT> value("1170.5", {2, 8});
+  value.setColor(Colors::White);
+  // the text is drawn at any row, not only at the page boundaries
+  Text<16, Fonts::Gauge16, CanvasT> clock("12:47", {70, 3});
+  clock.setColor(Colors::White);
+  Text<16, Fonts::Gauge16, CanvasT> change("-17,4%", {60, 28});
+  change.setColor(Colors::White);
+
+  canvas.draw(label);
+  canvas.draw(value);
+  canvas.draw(clock);
+  canvas.draw(change);
+  printCanvas(canvas);
+
+  const Rect bounds = value.getBounds();
+  std::cout << "Value bounds: [" << bounds.x0 << ", " << bounds.y0 << ", "
+            << bounds.x1 << ", " << bounds.y1 << ")\n"
+            << "Font tables: " << sizeof(Fonts::Gauge16Data::bitmaps) << " bytes of bitmaps, "
+            << sizeof(Fonts::Gauge16Data::glyphs) << " bytes of glyphs" << std::endl;
+}
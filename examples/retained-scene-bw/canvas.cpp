@@ -0,0 +1,105 @@
+#include <iostream>
+#include <EmbeddedGfx/BufferedCanvas.hpp>
+#include <EmbeddedGfx/RetainedScene.hpp>
+#include <EmbeddedGfx/Line.hpp>
+#include <EmbeddedGfx/Circle.hpp>
+#include <EmbeddedGfx/Rectangle.hpp>
+#include <EmbeddedGfx/Text.hpp>
+#include <EmbeddedGfx/Colors.hpp>
+
+template <typename CanvasT>
+void printCanvas(const CanvasT& canvas)
+{
+  auto rows = canvas.getHeight();
+  auto columns = canvas.getWidth();
+  const auto& matrix = canvas.getMatrix();
+  for(size_t x = 0; x < columns+2; ++x)
+  {
+    std::cout << "-";
+  }
+  std::cout << "\n";
+  for(size_t y = 0; y < rows; ++y)
+  {
+    std::cout << "|";
+    for(size_t x = 0; x < columns; ++x)
+    {
+      std::cout << ((matrix[y][x]) ? 'X' : ' ');
+    }
+    std::cout << "| \n";
+  }
+  for(size_t x = 0; x < columns+2; ++x)
+  {
+    std::cout << "-";
+  }
+  std::cout << std::endl;
+}
+
+template <typename SceneT>
+void printDamage(const SceneT& scene)
+{
+  long area = 0;
+  std::cout << "Damage:";
+  for(const auto& rect: scene.getDamage())
+  {
+    std::cout << " [" << rect.x0 << ", " << rect.y0 << ", " << rect.x1 << ", " << rect.y1 << ")";
+    area += rect.getArea();
+  }
+  std::cout << ", " << area << " pixels redrawn" << std::endl;
+}
+
+int main()
+{
+  using namespace EmbeddedGfx;
+  static constexpr size_t height = 64;
+  static constexpr size_t width = 128;
+  using CanvasT = BufferedCanvas<width, height, CanvasType::Normal, BlackAndWhite>;
+  CanvasT canvas;
+
+  // instrument panel: a dial with a needle, the value and a bar
+  Circle<CanvasT> dial({32, 32}, 28);
+  dial.setOutlineColor(Colors::White);
+  Line<CanvasT> needle{{32, 32}, {12, 32}, Colors::White};
+  Text<10, Font<6, 8>, CanvasT> label("RPM", {70, 4});
+  label.setColor(Colors::White);
+  Text<10, Font<6, 8>, CanvasT> value("1200", {70, 20});
+  value.setColor(Colors::White);
+  Rectangle<CanvasT> frame{{70.0f, 40.0f}, 50.0f, 10.0f};
+  frame.setOutlineColor(Colors::White);
+  Rectangle<CanvasT> bar{{72.0f, 42.0f}, 10.0f, 7.0f};
+  bar.setFillColor(Colors::White);
+
+  RetainedScene<CanvasT, 8> scene(canvas, Colors::Black);
+  scene.add(dial);
+  scene.add(needle);
+  scene.add(label);
+  scene.add(value);
+  scene.add(frame);
+  scene.add(bar);
+
+  // the first render draws the whole panel
+  printDamage(scene);
+  scene.render();
+  printCanvas(canvas);
+
+  // new reading: the needle and the bar move, the value changes
+  needle = Line<CanvasT>{{32, 32}, {32, 12}, Colors::White};
+  bar = Rectangle<CanvasT>{{72.0f, 42.0f}, 30.0f, 7.0f};
+  bar.setFillColor(Colors::White);
+  value.setString("3400");
+  scene.invalidate(value);
+  scene.update();
+  printDamage(scene);
+  scene.render();
+  printCanvas(canvas);
+
+  // the same panel drawn from scratch
+  CanvasT reference;
+  reference.draw(dial);
+  reference.draw(needle);
+  reference.draw(label);
+  reference.draw(value);
+  reference.draw(frame);
+  reference.draw(bar);
+  std::cout << "Same as full redraw: "
+            << ((reference.getMatrix() == canvas.getMatrix()) ? "yes" : "no") << std::endl;
+}
@@ -0,0 +1,148 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <iostream>
+#include <EmbeddedGfx/BufferedCanvas.hpp>
+#include <EmbeddedGfx/Scene.hpp>
+#include <EmbeddedGfx/Line.hpp>
+#include <EmbeddedGfx/Ellipse.hpp>
+#include <EmbeddedGfx/Circle.hpp>
+#include <EmbeddedGfx/Polygon.hpp>
+#include <EmbeddedGfx/Triangle.hpp>
+#include <EmbeddedGfx/Rectangle.hpp>
+#include <EmbeddedGfx/Text.hpp>
+#include <EmbeddedGfx/Colors.hpp>
+
+/**
+ * @brief Draw the frame the given number of times and return
+ * the average time of one frame in microseconds.
+ */
+template <typename CanvasT, typename DrawFrameT>
+double measure(CanvasT& canvas, const size_t frames, DrawFrameT drawFrame)
+{
+  const auto start = std::chrono::steady_clock::now();
+  for(size_t i = 0; i < frames; ++i)
+  {
+    canvas.clear(EmbeddedGfx::Colors::Black);
+    drawFrame();
+  }
+  const auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::micro>(end - start).count() / frames;
+}
+
+/**
+ * @brief Get the median of the measured times, which is not
+ * skewed by the repetitions disturbed by other processes.
+ */
+template <size_t Count>
+double median(std::array<double, Count> times)
+{
+  std::sort(times.begin(), times.end());
+  return (Count % 2) ? times[Count / 2] : (times[Count / 2 - 1] + times[Count / 2]) / 2;
+}
+
+int main()
+{
+  using namespace EmbeddedGfx;
+  static constexpr size_t height = 64;
+  static constexpr size_t width = 128;
+  static constexpr size_t frames = 2000;
+  static constexpr size_t repetitions = 15;
+  using CanvasT = BufferedCanvas<width, height, CanvasType::Normal, RGB565>;
+  CanvasT virtualCanvas;
+  CanvasT directCanvas;
+  CanvasT staticCanvas;
+  CanvasT variantCanvas;
+
+  Line<CanvasT> line{{1, 2}, {120, 60}, Colors::White};
+  Ellipse<CanvasT> ellipse{{30, 30}, 20, 12};
+  ellipse.setOutlineColor(Colors::Red);
+  ellipse.setFillColor(Colors::Cyan);
+  Circle<CanvasT> circle({60, 20}, 15);
+  circle.setOutlineColor(Colors::White);
+  Polygon<4, CanvasT> polygon({{{90.0f, 10.0f}, {125.0f, 30.0f}, {100.0f, 60.0f}, {60.0f, 50.0f}}});
+  polygon.setOutlineColor(Colors::Green);
+  polygon.setFillColor(Colors::Red);
+  Triangle<CanvasT> triangle({{{60.0f, 60.0f}, {40.0f, 40.0f}, {40.0f, 60.0f}}});
+  triangle.setOutlineColor(Colors::White);
+  Rectangle<CanvasT> rectangle{{5.0f, 45.0f}, 30.0f, 15.0f};
+  rectangle.setOutlineColor(Colors::White);
+  rectangle.setFillColor(Colors::Magenta);
+  Text<100, Font<6, 8>, CanvasT> text("Benchmark", {30.0f, 0.0f});
+  text.setColor(Colors::Yellow);
+
+  // virtual dispatch through the Drawable interface
+  const std::array<const Drawable<CanvasT>*, 7> drawables{
+    &line, &ellipse, &circle, &polygon, &triangle, &rectangle, &text};
+
+  // static dispatch, the types are part of the scene type
+  const StaticScene<CanvasT, Line<CanvasT>, Ellipse<CanvasT>, Circle<CanvasT>, Polygon<4, CanvasT>
+                  , Triangle<CanvasT>, Rectangle<CanvasT>, Text<100, Font<6, 8>, CanvasT>>
+    staticScene{line, ellipse, circle, polygon, triangle, rectangle, text};
+
+  // static dispatch, the objects can be added at runtime
+  VariantScene<CanvasT, 7, Line<CanvasT>, Ellipse<CanvasT>, Circle<CanvasT>, Polygon<4, CanvasT>
+             , Triangle<CanvasT>, Rectangle<CanvasT>, Text<100, Font<6, 8>, CanvasT>> variantScene;
+  variantScene.add(line);
+  variantScene.add(ellipse);
+  variantScene.add(circle);
+  variantScene.add(polygon);
+  variantScene.add(triangle);
+  variantScene.add(rectangle);
+  variantScene.add(text);
+
+  const auto drawVirtual = [&]() {
+    for(const auto* drawable: drawables)
+    {
+      virtualCanvas.draw(*drawable);
+    }
+  };
+  // the final shapes are drawn with static dispatch, Ellipse and
+  // Polygon are not final, so they are still drawn by virtual calls
+  const auto drawDirect = [&]() {
+    directCanvas.draw(line);
+    directCanvas.draw(ellipse);
+    directCanvas.draw(circle);
+    directCanvas.draw(polygon);
+    directCanvas.draw(triangle);
+    directCanvas.draw(rectangle);
+    directCanvas.draw(text);
+  };
+  const auto drawStaticScene = [&]() { staticCanvas.draw(staticScene); };
+  const auto drawVariantScene = [&]() { variantCanvas.draw(variantScene); };
+
+  // warm up the caches and the branch predictors of all the paths
+  measure(virtualCanvas, frames, drawVirtual);
+  measure(directCanvas, frames, drawDirect);
+  measure(staticCanvas, frames, drawStaticScene);
+  measure(variantCanvas, frames, drawVariantScene);
+
+  // the paths are interleaved, so that changes of the clock
+  // frequency and the load affect all of them alike
+  std::array<double, repetitions> virtualTimes{};
+  std::array<double, repetitions> directTimes{};
+  std::array<double, repetitions> staticTimes{};
+  std::array<double, repetitions> variantTimes{};
+  for(size_t i = 0; i < repetitions; ++i)
+  {
+    virtualTimes[i] = measure(virtualCanvas, frames, drawVirtual);
+    directTimes[i] = measure(directCanvas, frames, drawDirect);
+    staticTimes[i] = measure(staticCanvas, frames, drawStaticScene);
+    variantTimes[i] = measure(variantCanvas, frames, drawVariantScene);
+  }
+  const double virtualTime = median(virtualTimes);
+  const double directTime = median(directTimes);
+  const double staticTime = median(staticTimes);
+  const double variantTime = median(variantTimes);
+
+  const bool same = (virtualCanvas.getMatrix() == directCanvas.getMatrix())
+                 && (virtualCanvas.getMatrix() == staticCanvas.getMatrix())
+                 && (virtualCanvas.getMatrix() == variantCanvas.getMatrix());
+  std::cout << "Frames: " << frames << ", median of " << repetitions << " repetitions\n"
+            << "Virtual dispatch: " << virtualTime << " us per frame\n"
+            << "Direct calls:     " << directTime << " us per frame\n"
+            << "Static scene:     " << staticTime << " us per frame\n"
+            << "Variant scene:    " << variantTime << " us per frame\n"
+            << "Same output: " << (same ? "yes" : "no") << std::endl;
+  return same ? 0 : 1;
+}
@@ -75,7 +75,7 @@ int main()
   canvas.draw(circle);
 
   // Polygon test
-  Polygon<4, CanvasT> polygon({{{90.0f, 30.0f}, {100.0f, 50.0f}, {60.0f, 50.0f}, {110.0f, 30.0f}}});
+  Polygon<4, CanvasT> polygon({{{90.0f, 30.0f}, {110.0f, 30.0f}, {100.0f, 50.0f}, {60.0f, 50.0f}}});
   polygon.setOutlineColor(Colors::White);
   canvas.draw(polygon);
 
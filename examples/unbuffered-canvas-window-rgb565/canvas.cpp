@@ -0,0 +1,153 @@
+#include <array>
+#include <iostream>
+#include <EmbeddedGfx/UnbufferedCanvas.hpp>
+#include <EmbeddedGfx/Line.hpp>
+#include <EmbeddedGfx/Ellipse.hpp>
+#include <EmbeddedGfx/Circle.hpp>
+#include <EmbeddedGfx/Polygon.hpp>
+#include <EmbeddedGfx/Triangle.hpp>
+#include <EmbeddedGfx/Rectangle.hpp>
+#include <EmbeddedGfx/Text.hpp>
+#include <EmbeddedGfx/Colors.hpp>
+
+template <typename ColorT>
+char colorToChar(const typename ColorT::Type color)
+{
+  if(color == static_cast<ColorT>(EmbeddedGfx::Colors::White).getValue()) return 'W';
+  if(color == static_cast<ColorT>(EmbeddedGfx::Colors::Black).getValue()) return ' ';
+  if(color == static_cast<ColorT>(EmbeddedGfx::Colors::Blue).getValue()) return 'B';
+  if(color == static_cast<ColorT>(EmbeddedGfx::Colors::Red).getValue()) return 'R';
+  if(color == static_cast<ColorT>(EmbeddedGfx::Colors::Green).getValue()) return 'G';
+  if(color == static_cast<ColorT>(EmbeddedGfx::Colors::Yellow).getValue()) return 'Y';
+  if(color == static_cast<ColorT>(EmbeddedGfx::Colors::Cyan).getValue()) return 'C';
+  if(color == static_cast<ColorT>(EmbeddedGfx::Colors::Magenta).getValue()) return 'M';
+  return 'X';
+}
+
+/**
+ * @brief Display with address window, like ILI9341 or ST7789.
+ * Counts the address commands to show the saved bus traffic.
+ */
+template<size_t Width, size_t Height, typename ColorT>
+class VirtualDisplay
+{
+  public:
+    using PixelT = typename ColorT::Type;
+
+    void setPixel(const size_t x, const size_t y, const PixelT pixel)
+    {
+      setWindow(x, y, x, y);
+      writePixels(&pixel, 1);
+    }
+
+    void setWindow(const size_t x0, const size_t y0, const size_t x1, const size_t y1)
+    {
+      x0_ = x0;
+      x1_ = x1;
+      y1_ = y1;
+      x_ = x0;
+      y_ = y0;
+      ++windows_;
+    }
+
+    void writePixels(const PixelT* pixels, const size_t n)
+    {
+      for(size_t i = 0; i < n; ++i) write(pixels[i]);
+    }
+
+    void fillPixels(const PixelT pixel, const size_t n)
+    {
+      for(size_t i = 0; i < n; ++i) write(pixel);
+    }
+
+    void clear(const PixelT pixel)
+    {
+      setWindow(0, 0, Width - 1, Height - 1);
+      fillPixels(pixel, Width * Height);
+    }
+
+    void print() const
+    {
+      for(size_t x = 0; x < Width + 2; ++x) std::cout << "-";
+      std::cout << "\n";
+      for(size_t y = 0; y < Height; ++y)
+      {
+        std::cout << "|";
+        for(size_t x = 0; x < Width; ++x)
+        {
+          std::cout << colorToChar<ColorT>(frame_[y][x]);
+        }
+        std::cout << "| \n";
+      }
+      for(size_t x = 0; x < Width + 2; ++x) std::cout << "-";
+      std::cout << "\nWindows: " << windows_ << ", pixels: " << pixels_ << std::endl;
+    }
+  private:
+    void write(const PixelT pixel)
+    {
+      if(x_ < Width && y_ <= y1_ && y_ < Height) frame_[y_][x_] = pixel;
+      if(++x_ > x1_)
+      {
+        x_ = x0_;
+        ++y_;
+      }
+      ++pixels_;
+    }
+
+    std::array<std::array<PixelT, Width>, Height> frame_{};
+    size_t x0_ = 0, x1_ = 0, y1_ = 0, x_ = 0, y_ = 0;
+    size_t windows_ = 0;
+    size_t pixels_ = 0;
+};
+
+int main()
+{
+  using namespace EmbeddedGfx;
+  static constexpr size_t height = 64;
+  static constexpr size_t width = 128;
+  VirtualDisplay<width, height, RGB565> virtualDisplay;
+  // single pixels are merged into runs of up to 32 pixels
+  UnbufferedCanvas<width, height, CanvasType::Normal, RGB565, decltype(virtualDisplay), 32> canvas(virtualDisplay);
+  using CanvasT = decltype(canvas);
+  canvas.clear(Colors::Black);
+
+  // Line test
+  Line<CanvasT> line{{1, 2}, {20, 10}, Colors::Blue};
+  canvas.draw(line);
+
+  // Ellipse test
+  Ellipse<CanvasT> ellipse{{30, 30}, 10, 5};
+  ellipse.setOutlineColor(Colors::Red);
+  ellipse.setFillColor(Colors::Cyan);
+  canvas.draw(ellipse);
+
+  // Circle test
+  Circle<CanvasT> circle({60, 20}, 10);
+  circle.setOutlineColor(Colors::White);
+  canvas.draw(circle);
+
+  // Polygon test
+  Polygon<4, CanvasT> polygon({{{90.0f, 30.0f}, {110.0f, 30.0f}, {100.0f, 50.0f}, {60.0f, 50.0f}}});
+  polygon.setOutlineColor(Colors::Green);
+  polygon.setFillColor(Colors::Red);
+  canvas.draw(polygon);
+
+  // Triangle test
+  Triangle<CanvasT> triangle({{{60.0f, 60.0f}, {50.0f, 50.0f}, {50.0f, 60.0f}}});
+  triangle.setOutlineColor(Colors::White);
+  canvas.draw(triangle);
+
+  // Rectangle test
+  Rectangle<CanvasT> rectangle{{10.0f, 50.0f}, 20.0f, 10.0f};
+  rectangle.setOutlineColor(Colors::White);
+  canvas.draw(rectangle);
+
+  // Text test
+  Text<100, Font<6, 8>, CanvasT> text("Text test !!!", {30.0f, 0.0f});
+  text.setColor(Colors::Yellow);
+  canvas.draw(text);
+
+  // send the last queued run and print the display in the console
+  canvas.flush();
+  virtualDisplay.print();
+}
@@ -0,0 +1,229 @@
+#ifndef EMBEDDED_GFX_ASYNC_FLUSH_HPP
+#define EMBEDDED_GFX_ASYNC_FLUSH_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+#include "Canvas.hpp"
+
+namespace EmbeddedGfx
+{
+  /**
+   * @brief Callback the display calls when a transfer is completed.
+   * It can be called from an interrupt or from another thread.
+   * 
+   */
+  struct TransferCallback
+  {
+    void (*function)(void* context);
+    void* context;
+
+    void operator()() const
+    {
+      function(context);
+    }
+  };
+
+  /**
+   * @brief Class streaming pixels to the display through two
+   * line buffers used in turns (ping-pong).
+   * 
+   * While one buffer is transferred, for example by DMA, the other
+   * one is filled, so drawing and transfer overlap. The object can
+   * be used as display for BandCanvas, which with external band draws
+   * right into the acquired buffers, or to flush the matrix of
+   * a BufferedCanvas with Normal layout, or with indexed colors
+   * expanded through a palette.
+   * 
+   * @tparam PixelType The type of the pixel value.
+   * @tparam BufferSize The number of pixels in each of the buffers.
+   * @tparam DisplayT The type for the display device.
+   * @note DisplayT must have method beginTransfer(pixels, n, callback), which
+   * starts sending n pixels and calls callback() when the pixels are sent.
+   * The pixels are sent in order, so the display window must be set before
+   * streaming.
+   */
+  template <typename PixelType, size_t BufferSize, typename DisplayT>
+  class AsyncFlush
+  {
+    public:
+      using PixelT = PixelType;
+      using BufferT = std::array<PixelT, BufferSize>;
+      static constexpr size_t BufferCount = 2;
+      static_assert(BufferSize > 0, "Buffer must hold at least one pixel.");
+
+      /**
+       * @brief Construct a new Async Flush object.
+       * 
+       * @param display Reference to the display interface.
+       */
+      AsyncFlush(DisplayT& display) : display_{display} {}
+
+      AsyncFlush(const AsyncFlush&) = delete;
+      AsyncFlush& operator=(const AsyncFlush&) = delete;
+
+      /**
+       * @brief Destroy the Async Flush object, waiting
+       * for the transfers in flight.
+       * 
+       */
+      ~AsyncFlush()
+      {
+        waitIdle();
+      }
+
+      /**
+       * @brief Get the buffer to be filled next. Waits until
+       * its previous transfer is completed.
+       * 
+       * @return PixelT* Pointer to BufferSize pixels.
+       */
+      PixelT* acquire()
+      {
+        waitFor(current_);
+        return buffers_[current_].data();
+      }
+
+      /**
+       * @brief Start the transfer of the acquired buffer and
+       * switch to the other buffer.
+       * 
+       * @param length The number of pixels to send.
+       */
+      void submit(const size_t length)
+      {
+        busy_[current_].store(true, std::memory_order_release);
+        display_.beginTransfer(buffers_[current_].data(), length
+                             , TransferCallback{&AsyncFlush::release, &busy_[current_]});
+        current_ = (current_ + 1) % BufferCount;
+        filled_ = 0;
+      }
+
+      /**
+       * @brief Copy rows of pixels into the buffers, starting
+       * the transfer of every buffer that gets full, and of the
+       * last one at the end.
+       * 
+       * @param y The first row of the band, unused as the
+       * pixels are streamed in order.
+       * @param rows The number of rows to send.
+       * @param matrix The rows of pixels.
+       */
+      template <typename MatrixT>
+      void writeBand([[maybe_unused]] const size_t y, const size_t rows, const MatrixT& matrix)
+      {
+        for(size_t row = 0; row < rows; ++row)
+        {
+          append(matrix[row].data(), matrix[row].size());
+        }
+        if(filled_ != 0) submit(filled_);
+      }
+
+      /**
+       * @brief Stream the whole matrix of the canvas. Once the
+       * function returns, the canvas can be drawn again while the
+       * last buffers are still in flight.
+       * 
+       * @param canvas Reference to the canvas with Normal layout.
+       */
+      template <typename CanvasT>
+      void flush(const CanvasT& canvas)
+      {
+        static_assert(CanvasT::canvasType == CanvasType::Normal
+                    , "Only the matrix of canvas with Normal layout holds pixels, use the palette overload for Packed layouts.");
+        // the matrix is in the native orientation of the display
+        writeBand(0, CanvasT::NativeHeight, canvas.getMatrix());
+      }
+
+      /**
+       * @brief Stream the whole matrix of the canvas, expanding its
+       * values through the palette one row at a time. The rows are
+       * expanded right into the line buffers whenever they fit.
+       * 
+       * @param canvas Reference to the canvas with Normal or Packed layout,
+       * for example with indexed colors.
+       * @param palette Table mapping the values of the canvas to PixelT.
+       */
+      template <typename CanvasT, typename PaletteT>
+      void flush(const CanvasT& canvas, const PaletteT& palette)
+      {
+        static_assert(PaletteT::size() >= CanvasT::ValueCount, "Palette must have color for every value of the canvas.");
+        constexpr size_t width = CanvasT::NativeWidth;
+        for(size_t row = 0; row < CanvasT::NativeHeight; ++row)
+        {
+          if constexpr(width <= BufferSize)
+          {
+            // rows are not split between the buffers
+            if(filled_ + width > BufferSize) submit(filled_);
+            if(filled_ == 0) acquire();
+            canvas.expandRow(row, palette, buffers_[current_].begin() + filled_);
+            filled_ += width;
+            if(filled_ == BufferSize) submit(filled_);
+          }
+          else
+          {
+            std::array<PixelT, width> line;
+            canvas.expandRow(row, palette, line.begin());
+            append(line.data(), width);
+          }
+        }
+        if(filled_ != 0) submit(filled_);
+      }
+
+      /**
+       * @brief Check if any transfer is in flight.
+       */
+      bool isBusy() const
+      {
+        return std::any_of(busy_.begin(), busy_.end()
+                          , [](const auto& busy) { return busy.load(std::memory_order_acquire); });
+      }
+
+      /**
+       * @brief Wait until all transfers are completed.
+       * 
+       */
+      void waitIdle()
+      {
+        for(size_t i = 0; i < BufferCount; ++i) waitFor(i);
+      }
+
+    private:
+      /**
+       * @brief Copy pixels into the buffers, starting the
+       * transfer of every buffer that gets full.
+       */
+      void append(const PixelT* pixels, const size_t n)
+      {
+        for(size_t copied = 0; copied < n; )
+        {
+          if(filled_ == 0) acquire();
+          const size_t count = std::min(n - copied, BufferSize - filled_);
+          std::copy_n(pixels + copied, count, buffers_[current_].begin() + filled_);
+          copied += count;
+          filled_ += count;
+          if(filled_ == BufferSize) submit(filled_);
+        }
+      }
+
+      static void release(void* busy)
+      {
+        static_cast<std::atomic<bool>*>(busy)->store(false, std::memory_order_release);
+      }
+
+      void waitFor(const size_t index) const
+      {
+        while(busy_[index].load(std::memory_order_acquire)) { }
+      }
+
+      DisplayT& display_;
+      std::array<BufferT, BufferCount> buffers_{};
+      std::array<std::atomic<bool>, BufferCount> busy_{};
+      size_t current_ = 0;
+      size_t filled_ = 0;
+  };
+}
+
+#endif //EMBEDDED_GFX_ASYNC_FLUSH_HPP
@@ -0,0 +1,191 @@
+#ifndef EMBEDDED_GFX_BAND_CANVAS_HPP
+#define EMBEDDED_GFX_BAND_CANVAS_HPP
+
+#include <array>
+#include <cstddef>
+
+#include "BufferedCanvas.hpp"
+#include "Canvas.hpp"
+
+namespace EmbeddedGfx
+{
+  /**
+   * @brief Class representing canvas which holds only a band
+   * of rows in memory.
+   * 
+   * The drawables are recorded and drawn again for every band,
+   * with everything outside of the band clipped. Each finished
+   * band is sent to the display in one transfer. This way large
+   * displays can be drawn with batched transfers, using only a
+   * fraction of the memory needed for the whole frame.
+   * 
+   * @tparam Width The width of the canvas in pixels.
+   * @tparam Height The height of the canvas in pixels.
+   * @tparam BandHeight The number of rows held in memory. With Dithered
+   * colors it must be multiple of the size of the dither pattern.
+   * @tparam Type The type of the band buffer.
+   * @tparam ColorType The color representation type.
+   * @tparam MaxDrawables The number of drawables that can be recorded.
+   * @tparam ExternalBand The band is drawn straight into the buffers of the
+   * display instead of a buffer of its own. Available only for Normal layout.
+   * @note DisplayT must have method writeBand(y, rows, matrix), where y is
+   * the first row of the band, rows is the number of valid rows and matrix
+   * is the matrix of the band buffer. With external band DisplayT must
+   * instead have type BufferT, method acquire() returning pointer to a
+   * buffer of BufferT and method submit(n) sending n pixels of the buffer,
+   * for example AsyncFlush.
+   */
+  template<size_t Width, size_t Height, size_t BandHeight, CanvasType Type, typename ColorType, size_t MaxDrawables, bool ExternalBand = false>
+  class BandCanvas
+    : public Canvas<Width, Height, Type, ColorType
+                  , BandCanvas<Width, Height, BandHeight, Type, ColorType, MaxDrawables, ExternalBand>>
+  {
+    using BaseT = Canvas<Width, Height, Type, ColorType, BandCanvas>;
+    public:
+      using ColorT = typename BaseT::ColorT;
+      using PixelT = typename BaseT::PixelT;
+      using DrawableT = typename BaseT::DrawableT;
+      using BandT = BufferedCanvas<Width, BandHeight, Type, ColorType, Orientation<>, ExternalBand>;
+      using MatrixT = typename BandT::MatrixT;
+      static_assert(BandHeight > 0 && BandHeight <= Height, "Band height must be between 1 and the height of the canvas.");
+      static_assert(Type != CanvasType::Page || (BandHeight % BandT::PageSize) == 0
+                  , "Band height must be multiple of the page size when using Page mode.");
+      // the band is dithered in its own rows, so every band must start at a row of the pattern
+      static_assert(!BandT::IsDithered || (BandHeight % OrderedDither::Size) == 0
+                  , "Band height must be multiple of the dither pattern size when using Dithered colors.");
+
+      /**
+       * @brief Record drawable to be drawn on every render.
+       * The drawable must outlive the recording.
+       * 
+       * @param drawable Reference to drawable object.
+       * @return true The drawable was recorded.
+       * @return false There is no space for more drawables.
+       */
+      bool add(const DrawableT& drawable)
+      {
+        if(drawableCount_ == MaxDrawables) return false;
+        drawables_[drawableCount_++] = &drawable;
+        return true;
+      }
+
+      /**
+       * @brief Remove all recorded drawables.
+       * 
+       */
+      void clearDrawables()
+      {
+        drawableCount_ = 0;
+      }
+
+      /**
+       * @brief Draw the recorded drawables band by band
+       * and send every band to the display.
+       * 
+       * @tparam DisplayT The type for the display device.
+       * @param display Reference to the display interface.
+       */
+      template <typename DisplayT>
+      void render(DisplayT& display)
+      {
+        for(size_t top = 0; top < Height; top += BandHeight)
+        {
+          bandTop_ = top;
+          if constexpr(ExternalBand)
+          {
+            static_assert(std::tuple_size_v<typename DisplayT::BufferT> >= Width * BandHeight
+                        , "Buffer of the display must hold the whole band.");
+            // waits until the buffer is sent, the other one can be in flight
+            band_.setMatrix(display.acquire());
+          }
+          band_.clear(background_);
+          // shapes skip the rows outside of the clip, so only the rows of
+          // the band are rasterized; when the clip stack is full the band
+          // buffer still clips everything, only slower
+          const bool clipped = this->pushClip(Rect{0, static_cast<int>(top), static_cast<int>(Width), static_cast<int>(top + BandHeight)});
+          for(size_t i = 0; i < drawableCount_; ++i)
+          {
+            this->draw(*drawables_[i]);
+          }
+          if(clipped) this->popClip();
+          const size_t rows = (Height - top < BandHeight) ? (Height - top) : BandHeight;
+          if constexpr(ExternalBand)
+          {
+            // the rows of the view are contiguous, so the band is sent as it is
+            display.submit(rows * Width);
+          }
+          else
+          {
+            display.writeBand(top, rows, band_.getMatrix());
+          }
+        }
+        bandTop_ = 0;
+      }
+
+      /**
+       * @brief Set the value of individual pixel,
+       * if it is in the current band.
+       * 
+       * @param x The x-coordinate of the pixel.
+       * @param y The y-coordinate of the pixel.
+       * @param value The encoded value of the pixel.
+       */
+      void setPixelRaw(const int x, const int y, const PixelT value)
+      {
+        if(y >= static_cast<int>(bandTop_) && BaseT::isInsideClip(x, y))
+        {
+          band_.setPixelRaw(x, y - static_cast<int>(bandTop_), value);
+        }
+      }
+
+      /**
+       * @brief Draw the part of column of up to 8 pixels
+       * which is in the current band.
+       * 
+       * @param x The x-coordinate of the column.
+       * @param y The y-coordinate of the pixel of bit 0.
+       * @param bits The pixels of the column.
+       * @param value The encoded value of the pixels.
+       */
+      void drawColumnRaw(const int x, const int y, const uint8_t bits, const PixelT value)
+      {
+        const uint8_t visible = BaseT::clipColumn(x, y, bits);
+        if(visible) band_.drawColumnRaw(x, y - static_cast<int>(bandTop_), visible, value);
+      }
+
+      /**
+       * @brief Fill the part of rectangular area which
+       * is in the current band.
+       * 
+       * @param x The x-coordinate of the top-left corner.
+       * @param y The y-coordinate of the top-left corner.
+       * @param w The width of the area in pixels.
+       * @param h The height of the area in pixels.
+       * @param value The encoded value of the pixels.
+       */
+      void fillRectRaw(const int x, const int y, const int w, const int h, const PixelT value)
+      {
+        int x0 = x, y0 = y, x1 = x + w, y1 = y + h;
+        if(!BaseT::clipArea(x0, y0, x1, y1)) return;
+        band_.fillRectRaw(x0, y0 - static_cast<int>(bandTop_), x1 - x0, y1 - y0, value);
+      }
+
+      /**
+       * @brief Set the color every band is cleared with before drawing.
+       * 
+       * @param color The background color.
+       */
+      void clear(const ColorT& color)
+      {
+        background_ = color;
+      }
+    private:
+      BandT band_;
+      std::array<const DrawableT*, MaxDrawables> drawables_{};
+      size_t drawableCount_ = 0;
+      size_t bandTop_ = 0;
+      ColorT background_{};
+  };
+}
+
+#endif //EMBEDDED_GFX_BAND_CANVAS_HPP
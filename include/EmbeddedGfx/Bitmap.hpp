@@ -0,0 +1,116 @@
+#ifndef EMBEDDED_GFX_BITMAP_HPP
+#define EMBEDDED_GFX_BITMAP_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "Colors.hpp"
+#include "Drawable.hpp"
+#include "Vector2D.hpp"
+
+namespace EmbeddedGfx
+{
+  /**
+   * @brief Class representing grayscale bitmap drawn with black
+   * and white pixels using Floyd-Steinberg error diffusion.
+   * 
+   * The error of every pixel is spread to its right and lower
+   * neighbours in sixteenths. Only the errors of two rows are kept,
+   * so drawing needs no dynamic memory.
+   * 
+   * @tparam Width The width of the bitmap in pixels.
+   * @tparam Height The height of the bitmap in pixels.
+   * @tparam CanvasT The type of the canvas.
+   * @tparam CoordinateT The type of the coordinates, for example float,
+   * int or fixed-point type.
+   */
+  template <size_t Width, size_t Height, typename CanvasT, typename CoordinateT = float>
+  class GrayBitmap final : public Drawable<CanvasT>
+  {
+    public:
+      using ColorT = typename CanvasT::ColorT;
+      using PixelT = typename CanvasT::PixelT;
+      using DataT = std::array<std::array<uint8_t, Width>, Height>;
+      using PointT = Vector2D<CoordinateT>;
+    public:
+      /**
+       * @brief Construct a new Gray Bitmap object.
+       * 
+       * @param data Reference to the intensities of the pixels, 0 is black
+       * and 255 is white. The data is not copied and must outlive the bitmap.
+       * @param pos The coordinates of the top-left corner.
+       */
+      constexpr GrayBitmap(const DataT& data, const PointT& pos = {})
+        : data_{&data}
+        , position_{pos}
+      {
+      }
+
+      /**
+       * @brief Draw the bitmap on the canvas.
+       * 
+       * @param canvas Reference to the canvas.
+       */
+      void draw(CanvasT& canvas) const override
+      {
+        const Rect bounds = getBounds();
+        const Rect& clip = canvas.getClip();
+        if(!bounds.intersects(clip)) return;
+        const PixelT white = ColorT{Colors::White}.getValue();
+        const PixelT black = ColorT{Colors::Black}.getValue();
+        const int left = bounds.x0;
+        const int top = bounds.y0;
+        // the error flows only down, so the rows below the clip area are skipped
+        const size_t rows = std::min(Height, static_cast<size_t>(clip.y1 - top));
+        // errors of the current and the next row in sixteenths,
+        // with one guard element at both ends
+        std::array<int16_t, Width + 2> current{};
+        std::array<int16_t, Width + 2> next{};
+        for(size_t y = 0; y < rows; ++y)
+        {
+          for(size_t x = 0; x < Width; ++x)
+          {
+            const int intensity = (*data_)[y][x] + current[x + 1] / 16;
+            const bool on = intensity >= 128;
+            const int error = intensity - (on ? 255 : 0);
+            current[x + 2] += static_cast<int16_t>(error * 7);
+            next[x] += static_cast<int16_t>(error * 3);
+            next[x + 1] += static_cast<int16_t>(error * 5);
+            next[x + 2] += static_cast<int16_t>(error);
+            canvas.setPixelRaw(left + static_cast<int>(x), top + static_cast<int>(y), on ? white : black);
+          }
+          current = next;
+          next.fill(0);
+        }
+      }
+
+      /**
+       * @brief Get the smallest rectangle containing all the pixels of the bitmap.
+       * 
+       * @return Rect The bounding box.
+       */
+      Rect getBounds() const override
+      {
+        return Rect::fromSize(roundCoordinate(position_.x), roundCoordinate(position_.y)
+                            , static_cast<int>(Width), static_cast<int>(Height));
+      }
+
+      /**
+       * @brief Set the top-left corner of the bitmap.
+       * 
+       * @param pos Coordinates of the top-left corner.
+       */
+      constexpr void setPosition(const PointT& pos)
+      {
+        position_ = pos;
+      }
+
+    private:
+      const DataT* data_;
+      PointT position_;
+  };
+}
+
+#endif //EMBEDDED_GFX_BITMAP_HPP
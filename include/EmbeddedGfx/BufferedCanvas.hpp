@@ -2,6 +2,12 @@
 #define EMBEDDED_GFX_BUFFERED_CANVAS_HPP
 
 #include "Canvas.hpp"
+#include "DirtyRegion.hpp"
+#include "Dither.hpp"
+#include "Fill.hpp"
+#include "MatrixView.hpp"
+#include "Orientation.hpp"
+#include "Rect.hpp"
 
 namespace EmbeddedGfx
 {
@@ -12,28 +18,60 @@ namespace EmbeddedGfx
    * @tparam Height The height of the canvas in pixels.
    * @tparam Type The type of the canvas.
    * @tparam ColorType The color representation type.
+   * @tparam OrientationT The rotation and mirroring of the canvas on the display.
+   * @tparam ExternalMatrix The matrix is not held by the canvas, but set with
+   * setMatrix, for example to draw straight into the buffers of AsyncFlush.
+   * Available only for Normal layout.
+   * @note The matrix and the dirty region are in the native coordinates of the
+   * display, the drawing methods take the coordinates of the canvas.
    */
-  template<size_t Width, size_t Height, CanvasType Type, typename ColorType>
+  template<size_t Width, size_t Height, CanvasType Type, typename ColorType, typename OrientationT = Orientation<>, bool ExternalMatrix = false>
   class BufferedCanvas
     : public Canvas<Width, Height, Type, ColorType
-                  , BufferedCanvas<Width, Height, Type, ColorType>>
+                  , BufferedCanvas<Width, Height, Type, ColorType, OrientationT, ExternalMatrix>>
   {
     using BaseT = Canvas<Width, Height, Type, ColorType, BufferedCanvas>;
     public:
       using ColorT = typename BaseT::ColorT;
       using PixelT = typename BaseT::PixelT;
-      using ColorAndSimpleMatrixT = std::array<std::array<PixelT, Width>, Height>;
+      static constexpr size_t NativeWidth = OrientationT::swapsAxes ? Height : Width;
+      static constexpr size_t NativeHeight = OrientationT::swapsAxes ? Width : Height;
+      using ColorAndSimpleMatrixT = std::array<std::array<PixelT, NativeWidth>, NativeHeight>;
       static constexpr uint8_t PageSize = 8;
-      using PageMatrixT = std::array<std::array<uint8_t, Width>, Height/PageSize + ((Height % PageSize) != 0)>; 
+      static constexpr size_t PageCount = NativeHeight/PageSize + ((NativeHeight % PageSize) != 0);
+      using PageMatrixT = std::array<std::array<uint8_t, NativeWidth>, PageCount>; 
+      static constexpr bool IsPacked = (Type == CanvasType::PackedMsbFirst) || (Type == CanvasType::PackedLsbFirst);
+      static constexpr size_t PackedBits = BitsPerPixel<ColorType>::value;
+      static constexpr size_t PixelsPerByte = (PackedBits != 0) ? 8 / PackedBits : 1;
+      /// The number of values a pixel can have, the minimum size of the palette.
+      static constexpr size_t ValueCount = size_t{1} << PackedBits;
+      static constexpr uint8_t PixelMask = static_cast<uint8_t>((1u << PackedBits) - 1);
+      static constexpr bool IsDithered = std::is_same_v<ColorType, Dithered>;
+      static constexpr size_t BytesPerRow = (NativeWidth + PixelsPerByte - 1) / PixelsPerByte;
+      using PackedMatrixT = std::array<std::array<uint8_t, BytesPerRow>, NativeHeight>;
       using MatrixT = std::conditional_t<
-                          Type == CanvasType::Page
-                        , PageMatrixT
-                        , ColorAndSimpleMatrixT>;
-      BufferedCanvas() : matrix_{{}}
+                          ExternalMatrix
+                        , MatrixView<PixelT, NativeWidth, NativeHeight>
+                        , std::conditional_t<
+                              Type == CanvasType::Page
+                            , PageMatrixT
+                            , std::conditional_t<
+                                  IsPacked
+                                , PackedMatrixT
+                                , ColorAndSimpleMatrixT>>>;
+      static constexpr size_t MaxDirtyRects = 4;
+      using DirtyRegionT = DirtyRegion<MaxDirtyRects>;
+      using PageDirtyRegionT = PageDirtyRegion<(Type == CanvasType::Page) ? PageCount : 0, NativeWidth>;
+      BufferedCanvas() : matrix_{}
       {
+        static_assert(!ExternalMatrix || Type == CanvasType::Normal, "External matrix is available only for Normal layout.");
         if constexpr(Type == CanvasType::Page)
         {
-          static_assert(std::is_same_v<ColorT, BlackAndWhite>, "Color type must be black and white when using Page mode.");
+          static_assert(std::is_same_v<ColorT, BlackAndWhite> || IsDithered, "Color type must be black and white when using Page mode.");
+        }
+        else if constexpr(IsPacked)
+        {
+          static_assert(PackedBits != 0, "Color type must be black and white or indexed when using Packed mode.");
         }
       }
 
@@ -43,30 +81,174 @@ namespace EmbeddedGfx
        * @return const auto& The matrix of the canvas.
        */
       const auto& getMatrix() const { return matrix_; }
+
+      /**
+       * @brief Set the memory the canvas draws into, only with external matrix.
+       * The content of the memory is kept, the dirty region is not changed.
+       * 
+       * @param pixels Pointer to NativeWidth * NativeHeight pixels, row after row.
+       */
+      void setMatrix(PixelT* pixels)
+      {
+        static_assert(ExternalMatrix, "Matrix can be set only when it is external.");
+        matrix_ = MatrixT{pixels};
+      }
+
+      /**
+       * @brief Get the value of individual pixel, regardless of
+       * the layout of the matrix.
+       * 
+       * @param x The x-coordinate of the pixel.
+       * @param y The y-coordinate of the pixel.
+       * @return PixelT The value of the pixel.
+       */
+      PixelT getPixel(size_t x, size_t y) const
+      {
+        OrientationT::template mapPoint<Width, Height>(x, y);
+        if constexpr(Type == CanvasType::Page)
+        {
+          return matrix_[y/PageSize][x] & (1 << (y % PageSize));
+        }
+        else if constexpr(IsPacked)
+        {
+          return static_cast<PixelT>((matrix_[y][x / PixelsPerByte] >> packedShift(x % PixelsPerByte)) & PixelMask);
+        }
+        else
+        {
+          return matrix_[y][x];
+        }
+      }
+
+      /**
+       * @brief Get the areas modified since the dirty region was last cleared.
+       * Display drivers can transfer only these areas of the matrix.
+       * 
+       * @return const DirtyRegionT& The modified areas.
+       */
+      const DirtyRegionT& getDirtyRegion() const { return dirty_; }
+
+      /**
+       * @brief Get the modified bytes of every dirty page, only for Page mode.
+       * Each run holds the page, the first and the last column and the bytes
+       * of those columns, matching the controller's addressing commands.
+       * 
+       * @return auto Range of the runs of the dirty pages.
+       */
+      auto getDirtyPages() const
+      {
+        static_assert(Type == CanvasType::Page, "Dirty pages are available only in Page mode.");
+        return pageDirty_.getRuns(matrix_);
+      }
+
+      /**
+       * @brief Mark the whole canvas as transferred to the display.
+       * 
+       */
+      void clearDirtyRegion()
+      {
+        dirty_.clear();
+        pageDirty_.clear();
+      }
       
       /**
        * @brief Set the value of individual pixel.
        * 
        * @param x The x-coordinate of the pixel.
        * @param y The y-coordinate of the pixel.
-       * @param pixel The value of the pixel.
+       * @param value The encoded value of the pixel.
        */
-      void setPixel(const size_t x, const size_t y, const ColorT& pixel)
+      void setPixelRaw(const int x, const int y, const PixelT value)
       {
-        if(y < Height && x < Width)
+        if(BaseT::isInsideClip(x, y))
         {
+          size_t column = static_cast<size_t>(x);
+          size_t row = static_cast<size_t>(y);
+          OrientationT::template mapPoint<Width, Height>(column, row);
+          PixelT pixel = value;
+          if constexpr(IsDithered)
+          {
+            pixel = OrderedDither::isSet(column, row, value);
+          }
           if constexpr (Type == CanvasType::Normal)
           {
-            matrix_[y][x] = matrix_[y][x] = pixel.getValue();
+            matrix_[row][column] = pixel;
           }
           else if constexpr(Type == CanvasType::Page)
           {
-            if(pixel.getValue()) matrix_[y/PageSize][x] |= 1 << (y % PageSize);
-            else matrix_[y/PageSize][x] &= ~(1 << (y % PageSize));
+            if(pixel) matrix_[row/PageSize][column] |= 1 << (row % PageSize);
+            else matrix_[row/PageSize][column] &= ~(1 << (row % PageSize));
+            pageDirty_.add(row/PageSize, column, column);
           }
+          else if constexpr(IsPacked)
+          {
+            const uint8_t mask = packedMask(column % PixelsPerByte, column % PixelsPerByte + 1);
+            auto& byte = matrix_[row][column / PixelsPerByte];
+            byte = (byte & ~mask) | (packedFill(pixel) & mask);
+          }
+          dirty_.add(Rect::fromSize(static_cast<int>(column), static_cast<int>(row), 1, 1));
         }
       }
 
+      /**
+       * @brief Draw column of up to 8 pixels from a byte. Only the
+       * pixels whose bits are set are drawn.
+       * 
+       * @param x The x-coordinate of the column.
+       * @param y The y-coordinate of the pixel of bit 0.
+       * @param bits The pixels of the column.
+       * @param value The encoded value of the pixels.
+       */
+      void drawColumnRaw(const int x, const int y, const uint8_t bits, const PixelT value)
+      {
+        if constexpr(Type == CanvasType::Page && !IsDithered && OrientationT::rotation == Rotation::Rotate0)
+        {
+          // the bits have the layout of the page bytes, so the column is
+          // shifted into at most two bytes instead of setting every pixel
+          const uint8_t visible = BaseT::clipColumn(x, y, bits);
+          if(!visible) return;
+          size_t column = static_cast<size_t>(x);
+          size_t row = 0;
+          OrientationT::template mapPoint<Width, Height>(column, row);
+          const int page = (y >= 0) ? y / PageSize : -((PageSize - 1 - y) / PageSize);
+          const uint16_t shifted = static_cast<uint16_t>(visible << (y - page * PageSize));
+          for(int i = 0; i < 2; ++i)
+          {
+            const uint8_t part = static_cast<uint8_t>(shifted >> (i * PageSize));
+            if(!part) continue;
+            auto& byte = matrix_[page + i][column];
+            if(value) byte |= part;
+            else byte &= ~part;
+            pageDirty_.add(page + i, column, column);
+          }
+          const Rect& clip = BaseT::getClip();
+          dirty_.add({static_cast<int>(column), std::max(y, clip.y0), static_cast<int>(column) + 1, std::min(y + 8, clip.y1)});
+        }
+        else
+        {
+          BaseT::drawColumnRaw(x, y, bits, value);
+        }
+      }
+
+      /**
+       * @brief Fill rectangular area of the canvas.
+       * 
+       * @param x The x-coordinate of the top-left corner.
+       * @param y The y-coordinate of the top-left corner.
+       * @param w The width of the area in pixels.
+       * @param h The height of the area in pixels.
+       * @param value The encoded value of the pixels.
+       */
+      void fillRectRaw(const int x, const int y, const int w, const int h, const PixelT value)
+      {
+        int x0 = x, y0 = y, x1 = x + w, y1 = y + h;
+        if(!BaseT::clipArea(x0, y0, x1, y1)) return;
+        // the rotated area is again a rectangle, so spans of the canvas
+        // become spans in the native direction of the matrix
+        OrientationT::template mapArea<Width, Height>(x0, y0, x1, y1);
+        dirty_.add({x0, y0, x1, y1});
+        fillArea(x0, y0, x1, y1, value);
+      }
+
       /**
        * @brief Clear the canvas with a given color.
        * 
@@ -74,17 +256,204 @@ namespace EmbeddedGfx
        */
       void clear(const ColorT& color)
       {
-        auto value = color.getValue();
-        for(size_t y = 0; y < matrix_.size(); ++y)
+        const auto value = color.getValue();
+        // every row is filled on its own, writing past the end of one
+        // std::array into the next one is undefined behaviour
+        if constexpr(IsDithered)
+        {
+          fillArea(0, 0, static_cast<int>(NativeWidth), static_cast<int>(NativeHeight), value);
+        }
+        else
         {
-          for(size_t x = 0; x < matrix_[0].size(); ++x)
+          for(size_t index = 0; index < matrix_.size(); ++index)
           {
-            matrix_[y][x] = value;
+            auto&& row = matrix_[index];
+            if constexpr(Type == CanvasType::Page)
+            {
+              fillPixels<uint8_t>(row.data(), row.size(), value ? 0xFF : 0x00);
+            }
+            else if constexpr(IsPacked)
+            {
+              fillPixels(row.data(), row.size(), packedFill(value));
+            }
+            else
+            {
+              fillPixels(row.data(), row.size(), value);
+            }
           }
         }
+        dirty_.add({0, 0, static_cast<int>(NativeWidth), static_cast<int>(NativeHeight)});
+        pageDirty_.addAll();
+      }
+
+      /**
+       * @brief Expand one row of the matrix into the pixel values of the
+       * display, for example palette indices into RGB565 pixels.
+       * Available for Normal and Packed layouts.
+       * 
+       * @param row The native row of the matrix.
+       * @param palette Table mapping the values of the canvas to the
+       * values of the display, indexed with operator[].
+       * @param pixels Output iterator for NativeWidth pixels.
+       */
+      template<typename PaletteT, typename OutputIt>
+      void expandRow(const size_t row, const PaletteT& palette, OutputIt pixels) const
+      {
+        static_assert(Type != CanvasType::Page, "Rows can't be expanded in Page mode.");
+        static_assert(PackedBits != 0, "Rows can be expanded only for indexed or black and white colors.");
+        static_assert(PaletteT::size() >= ValueCount, "Palette must have color for every value of the canvas.");
+        const auto& source = matrix_[row];
+        if constexpr(IsPacked)
+        {
+          // the pixels of one byte are extracted with fixed shifts
+          size_t x = 0;
+          for(const uint8_t byte: source)
+          {
+            for(size_t i = 0; i < PixelsPerByte && x < NativeWidth; ++i, ++x)
+            {
+              *pixels++ = palette[(byte >> packedShift(i)) & PixelMask];
+            }
+          }
+        }
+        else
+        {
+          for(const auto value: source) *pixels++ = palette[value];
+        }
       }
     private:
+      /**
+       * @brief Fill rectangular area of the matrix, in the native
+       * coordinates and already clipped.
+       */
+      void fillArea(const int x0, const int y0, const int x1, const int y1, const PixelT value)
+      {
+        if constexpr (Type == CanvasType::Normal)
+        {
+          // rows are contiguous in memory
+          for(int row = y0; row < y1; ++row)
+          {
+            if constexpr(IsDithered)
+            {
+              const uint8_t pattern = OrderedDither::getRow<true>(row, value);
+              for(int column = x0; column < x1; ++column)
+              {
+                matrix_[row][column] = (pattern >> (7 - column % 8)) & 1;
+              }
+            }
+            else
+            {
+              fillPixels(matrix_[row].data() + x0, static_cast<size_t>(x1 - x0), value);
+            }
+          }
+        }
+        else if constexpr(Type == CanvasType::Page)
+        {
+          // every page byte holds 8 vertical pixels, so the rows
+          // of the area that fall in one page are written with one mask
+          for(int page = y0 / PageSize; page <= (y1 - 1) / PageSize; ++page)
+          {
+            const int pageTop = page * PageSize;
+            const int firstBit = std::max(y0 - pageTop, 0);
+            const int lastBit = std::min(y1 - pageTop, static_cast<int>(PageSize));
+            const uint8_t mask = static_cast<uint8_t>((0xFF << firstBit) & (0xFF >> (PageSize - lastBit)));
+            auto& pageRow = matrix_[page];
+            pageDirty_.add(page, x0, x1 - 1);
+            if constexpr(IsDithered)
+            {
+              // the pattern of a column repeats every 8 columns
+              for(int column = x0; column < x1; ++column)
+              {
+                const uint8_t pattern = OrderedDither::getColumn(column, value);
+                pageRow[column] = (pageRow[column] & ~mask) | (pattern & mask);
+              }
+            }
+            else if(mask == 0xFF)
+            {
+              fillPixels<uint8_t>(pageRow.data() + x0, static_cast<size_t>(x1 - x0), value ? 0xFF : 0x00);
+            }
+            else if(value)
+            {
+              for(int column = x0; column < x1; ++column) pageRow[column] |= mask;
+            }
+            else
+            {
+              for(int column = x0; column < x1; ++column) pageRow[column] &= ~mask;
+            }
+          }
+        }
+        else if constexpr(IsPacked)
+        {
+          // partial bytes at both ends are masked, the bytes between
+          // them are stored whole
+          constexpr int pixelsPerByte = PixelsPerByte;
+          const int firstByte = x0 / pixelsPerByte;
+          const int lastByte = (x1 - 1) / pixelsPerByte;
+          const uint8_t headMask = packedMask(x0 % pixelsPerByte
+                                            , (firstByte == lastByte) ? (x1 - firstByte * pixelsPerByte) : pixelsPerByte);
+          const uint8_t tailMask = packedMask(0, x1 - lastByte * pixelsPerByte);
+          for(int row = y0; row < y1; ++row)
+          {
+            uint8_t fillByte = packedFill(value);
+            if constexpr(IsDithered)
+            {
+              // every byte starts at column multiple of 8, so the whole row has one pattern
+              fillByte = OrderedDither::getRow<Type == CanvasType::PackedMsbFirst>(row, value);
+            }
+            auto& bytes = matrix_[row];
+            bytes[firstByte] = (bytes[firstByte] & ~headMask) | (fillByte & headMask);
+            if(firstByte == lastByte) continue;
+            fillPixels(bytes.data() + firstByte + 1, static_cast<size_t>(lastByte - firstByte - 1), fillByte);
+            bytes[lastByte] = (bytes[lastByte] & ~tailMask) | (fillByte & tailMask);
+          }
+        }
+      }
+
+      /**
+       * @brief Mask selecting pixels [first, last) of a byte
+       * in the packed layout.
+       */
+      static constexpr uint8_t packedMask(const int first, const int last)
+      {
+        const int firstBit = first * static_cast<int>(PackedBits);
+        const int lastBit = last * static_cast<int>(PackedBits);
+        if constexpr(Type == CanvasType::PackedMsbFirst)
+        {
+          return static_cast<uint8_t>((0xFF >> firstBit) & (0xFF << (8 - lastBit)));
+        }
+        else
+        {
+          return static_cast<uint8_t>((0xFF << firstBit) & (0xFF >> (8 - lastBit)));
+        }
+      }
+
+      /**
+       * @brief Position of the lowest bit of the pixel within
+       * a byte in the packed layout.
+       */
+      static constexpr int packedShift(const size_t pixel)
+      {
+        if constexpr(Type == CanvasType::PackedMsbFirst)
+        {
+          return static_cast<int>(8 - (pixel + 1) * PackedBits);
+        }
+        else
+        {
+          return static_cast<int>(pixel * PackedBits);
+        }
+      }
+
+      /**
+       * @brief Byte with all pixels set to the value
+       * in the packed layout.
+       */
+      static constexpr uint8_t packedFill(const PixelT value)
+      {
+        return static_cast<uint8_t>((value & PixelMask) * (0xFF / PixelMask));
+      }
+
       MatrixT matrix_;
+      DirtyRegionT dirty_;
+      PageDirtyRegionT pageDirty_;
   };
 }
 
@@ -1,6 +1,7 @@
 #ifndef EMBEDDED_GFX_CANVAS_HPP
 #define EMBEDDED_GFX_CANVAS_HPP
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <cstdint>
@@ -9,6 +10,7 @@
 
 #include "Colors.hpp"
 #include "Drawable.hpp"
+#include "Rect.hpp"
 #include "Vector2D.hpp"
 
 namespace EmbeddedGfx
@@ -20,8 +22,10 @@ namespace EmbeddedGfx
    */
   enum class CanvasType
   {
-    Normal,
-    Page
+    Normal,         //< one element per pixel, row by row
+    Page,           //< bytes hold 8 vertical pixels, as in SSD1306
+    PackedMsbFirst, //< pixels packed into bytes row by row, leftmost pixel in the MSB
+    PackedLsbFirst  //< pixels packed into bytes row by row, leftmost pixel in the LSB
   };
 
   /**
@@ -75,15 +79,150 @@ namespace EmbeddedGfx
       }
 
       /**
-       * @brief Set the value of individual pixel.
+       * @brief Draw object which doesn't derive from Drawable, for
+       * example scene container, or object of final class, for example
+       * Circle, with static dispatch.
+       * 
+       * The call is resolved at compile time, so the whole drawing
+       * can be inlined down to the pixel writes of the canvas. Objects
+       * of polymorphic classes which are not final, like Ellipse, may
+       * be bases of other objects, so they are drawn by virtual call.
+       * 
+       * @tparam T The type of the object, with method draw(CanvasT&) const.
+       * @param drawable Reference to the object.
+       */
+      template<typename T, typename std::enable_if_t<
+          IsDrawable<T, DerivedCanvasT>::value && (!std::is_polymorphic_v<T> || std::is_final_v<T>), int> = 0>
+      void draw(const T& drawable)
+      {
+        drawStatic(drawable, static_cast<DerivedCanvasT&>(*this));
+      }
+
+      /**
+       * @brief Set the value of individual pixel. Pixels
+       * outside of the clip area are discarded.
        * 
        * @param x The x-coordinate of the pixel.
        * @param y The y-coordinate of the pixel.
        * @param pixel The value of the pixel.
        */
-      void setPixel(const size_t x, const size_t y, const ColorT& pixel)
+      void setPixel(const int x, const int y, const ColorT& pixel)
+      {
+        setPixelRaw(x, y, pixel.getValue());
+      }
+
+      /**
+       * @brief Set the value of individual pixel, with the
+       * color already encoded for the canvas.
+       * 
+       * @param x The x-coordinate of the pixel.
+       * @param y The y-coordinate of the pixel.
+       * @param value The encoded value of the pixel.
+       */
+      void setPixelRaw(const int x, const int y, const PixelT value)
+      {
+        (static_cast<DerivedCanvasT&>(*this)).setPixelRaw(x, y, value);
+      }
+
+      /**
+       * @brief Draw horizontal run of pixels.
+       * 
+       * @param x The x-coordinate of the leftmost pixel.
+       * @param y The y-coordinate of the run.
+       * @param length The number of pixels in the run.
+       * @param pixel The value of the pixels.
+       */
+      void drawHSpan(const int x, const int y, const int length, const ColorT& pixel)
+      {
+        fillRectRaw(x, y, length, 1, pixel.getValue());
+      }
+
+      /**
+       * @brief Draw horizontal run of pixels, with the
+       * color already encoded for the canvas.
+       * 
+       * @param x The x-coordinate of the leftmost pixel.
+       * @param y The y-coordinate of the run.
+       * @param length The number of pixels in the run.
+       * @param value The encoded value of the pixels.
+       */
+      void drawHSpanRaw(const int x, const int y, const int length, const PixelT value)
+      {
+        fillRectRaw(x, y, length, 1, value);
+      }
+
+      /**
+       * @brief Draw vertical run of pixels.
+       * 
+       * @param x The x-coordinate of the run.
+       * @param y The y-coordinate of the topmost pixel.
+       * @param length The number of pixels in the run.
+       * @param pixel The value of the pixels.
+       */
+      void drawVSpan(const int x, const int y, const int length, const ColorT& pixel)
+      {
+        fillRectRaw(x, y, 1, length, pixel.getValue());
+      }
+
+      /**
+       * @brief Draw vertical run of pixels, with the
+       * color already encoded for the canvas.
+       * 
+       * @param x The x-coordinate of the run.
+       * @param y The y-coordinate of the topmost pixel.
+       * @param length The number of pixels in the run.
+       * @param value The encoded value of the pixels.
+       */
+      void drawVSpanRaw(const int x, const int y, const int length, const PixelT value)
+      {
+        fillRectRaw(x, y, 1, length, value);
+      }
+
+      /**
+       * @brief Draw column of up to 8 pixels from a byte, for example one
+       * column of a font glyph. Only the pixels whose bits are set are
+       * drawn, the others are left unchanged.
+       * 
+       * @param x The x-coordinate of the column.
+       * @param y The y-coordinate of the pixel of bit 0, the bit 7 is the lowest pixel.
+       * @param bits The pixels of the column.
+       * @param value The encoded value of the pixels.
+       */
+      void drawColumnRaw(const int x, const int y, const uint8_t bits, const PixelT value)
+      {
+        for(int bit = 0; bit < 8; ++bit)
+        {
+          if(bits & (1 << bit)) setPixelRaw(x, y + bit, value);
+        }
+      }
+
+      /**
+       * @brief Fill rectangular area of the canvas.
+       * 
+       * @param x The x-coordinate of the top-left corner.
+       * @param y The y-coordinate of the top-left corner.
+       * @param w The width of the area in pixels.
+       * @param h The height of the area in pixels.
+       * @param pixel The value of the pixels.
+       */
+      void fillRect(const int x, const int y, const int w, const int h, const ColorT& pixel)
+      {
+        fillRectRaw(x, y, w, h, pixel.getValue());
+      }
+
+      /**
+       * @brief Fill rectangular area of the canvas, with the
+       * color already encoded for the canvas.
+       * 
+       * @param x The x-coordinate of the top-left corner.
+       * @param y The y-coordinate of the top-left corner.
+       * @param w The width of the area in pixels.
+       * @param h The height of the area in pixels.
+       * @param value The encoded value of the pixels.
+       */
+      void fillRectRaw(const int x, const int y, const int w, const int h, const PixelT value)
       {
-        (static_cast<DerivedCanvasT&>(*this)).setPixel(x, y, pixel);
+        (static_cast<DerivedCanvasT&>(*this)).fillRectRaw(x, y, w, h, value);
       }
 
       /**
@@ -95,6 +234,107 @@ namespace EmbeddedGfx
       {
         (static_cast<DerivedCanvasT&>(*this)).clear(color);
       }
+
+      /**
+       * @brief Restrict drawing to the part of rectangular area which
+       * is inside the current clip area, for example for scroll views
+       * and windowed widgets. The pixels outside of the clip area are
+       * discarded, except by clear(), and the shapes which are completely
+       * outside of it are rejected before drawing.
+       * 
+       * @param clip The area, in the coordinates of the canvas.
+       * @return true The clip area was pushed.
+       * @return false The clip stack is full, the clip area didn't change.
+       */
+      bool pushClip(const Rect& clip)
+      {
+        if(clipDepth_ == MaxClipDepth) return false;
+        clipStack_[clipDepth_++] = clip_;
+        clip_ = clip_.intersected(clip);
+        return true;
+      }
+
+      /**
+       * @brief Restore the clip area which was active
+       * before the last pushClip().
+       * 
+       */
+      void popClip()
+      {
+        if(clipDepth_ > 0) clip_ = clipStack_[--clipDepth_];
+      }
+
+      /**
+       * @brief Get the area drawing is restricted to. It is empty
+       * when the pushed areas don't overlap.
+       */
+      const Rect& getClip() const
+      {
+        return clip_;
+      }
+
+      /**
+       * @brief Get the number of clip areas pushed and not popped yet.
+       */
+      size_t getClipDepth() const
+      {
+        return clipDepth_;
+      }
+
+      /// The number of clip areas that can be pushed at once.
+      static constexpr size_t MaxClipDepth = 4;
+    protected:
+      /**
+       * @brief Check if the pixel is inside the clip area.
+       * 
+       * @param x The x-coordinate of the pixel.
+       * @param y The y-coordinate of the pixel.
+       */
+      bool isInsideClip(const int x, const int y) const
+      {
+        return clip_.contains(x, y);
+      }
+
+      /**
+       * @brief Clip rectangular area to the clip area of the canvas.
+       * 
+       * @param x0 The x-coordinate of the top-left corner, inclusive.
+       * @param y0 The y-coordinate of the top-left corner, inclusive.
+       * @param x1 The x-coordinate of the bottom-right corner, exclusive.
+       * @param y1 The y-coordinate of the bottom-right corner, exclusive.
+       * @return true The clipped area is not empty.
+       * @return false Nothing of the area is on the canvas.
+       */
+      bool clipArea(int& x0, int& y0, int& x1, int& y1) const
+      {
+        x0 = std::max(x0, clip_.x0);
+        y0 = std::max(y0, clip_.y0);
+        x1 = std::min(x1, clip_.x1);
+        y1 = std::min(y1, clip_.y1);
+        return (x0 < x1) && (y0 < y1);
+      }
+
+      /**
+       * @brief Clear the bits of a column of 8 pixels which
+       * are outside of the clip area.
+       * 
+       * @param x The x-coordinate of the column.
+       * @param y The y-coordinate of the pixel of bit 0.
+       * @param bits The pixels of the column.
+       * @return uint8_t The pixels inside of the clip area.
+       */
+      uint8_t clipColumn(const int x, const int y, const uint8_t bits) const
+      {
+        if(x < clip_.x0 || x >= clip_.x1) return 0;
+        const int first = std::max(clip_.y0 - y, 0);
+        const int last = std::min(clip_.y1 - y, 8);
+        if(first >= last) return 0;
+        return bits & static_cast<uint8_t>((0xFF << first) & (0xFF >> (8 - last)));
+      }
+
+      Rect clip_{0, 0, static_cast<int>(Width), static_cast<int>(Height)};
+      std::array<Rect, MaxClipDepth> clipStack_{};
+      size_t clipDepth_ = 0;
   };
 }
 
@@ -1,6 +1,7 @@
 #ifndef EMBEDDED_GFX_CIRCLE_HPP
 #define EMBEDDED_GFX_CIRCLE_HPP
 
+
 #include "Ellipse.hpp"
 #include "Vector2D.hpp"
 
@@ -10,11 +11,15 @@ namespace EmbeddedGfx
    * @brief Class representing Circle.
    * 
    * @tparam CanvasT The type of the canvas.
+   * @tparam CoordinateT The type of the coordinates, for example float,
+   * int or fixed-point type.
    */
-  template <typename CanvasT>
-  class Circle : public Ellipse<CanvasT>
+  template <typename CanvasT, typename CoordinateT = float>
+  class Circle final : public Ellipse<CanvasT, CoordinateT>
   {
     public:
+      using PointT = Vector2D<CoordinateT>;
+
       /**
        * @brief Construct a new Circle object.
        * 
@@ -22,8 +27,8 @@ namespace EmbeddedGfx
        * @param y The y-coordinate of the center.
        * @param r The radius of the circle.
        */
-      Circle(float x = {}, float y = {}, float r = {})
-        : Ellipse<CanvasT>(x, y, r, r)
+      constexpr Circle(CoordinateT x = {}, CoordinateT y = {}, CoordinateT r = {})
+        : Ellipse<CanvasT, CoordinateT>(x, y, r, r)
       {
       }
 
@@ -33,9 +38,70 @@ namespace EmbeddedGfx
        * @param centerPoint The coordinates of the center.
        * @param r The radius of the circle.
        */
-      Circle(const Vector2Df& centerPoint, float r)
-        : Ellipse<CanvasT>(centerPoint, r, r)
+      constexpr Circle(const PointT& centerPoint, CoordinateT r)
+        : Ellipse<CanvasT, CoordinateT>(centerPoint, r, r)
+      {
+      }
+
+      /**
+       * @brief Draw the circle on the canvas.
+       * 
+       * @param canvas Reference to the canvas.
+       */
+      void draw(CanvasT& canvas) const override
+      {
+        if(!this->getBounds().intersects(canvas.getClip())) return;
+        if(this->fillColor_)
+        {
+          this->drawFill(canvas);
+        }
+        if(this->outlineColor_)
+        {
+          drawOutline(canvas);
+        }
+      }
+    protected:
+      /**
+       * @brief Draw the outline of the circle with the integer
+       * midpoint algorithm. One octant is computed and mirrored
+       * to the other seven. The points in the rows outside of the
+       * clip area are skipped.
+       * 
+       * @param canvas Reference to the canvas.
+       */
+      void drawOutline(CanvasT& canvas) const
       {
+        const int cx = roundCoordinate(this->centerPoint_.x);
+        const int cy = roundCoordinate(this->centerPoint_.y);
+        const int r = roundCoordinate(this->a_);
+        const auto& color = *(this->outlineColor_);
+        if(r <= 0)
+        {
+          canvas.setPixelRaw(cx, cy, color);
+          return;
+        }
+        const Rect& clip = canvas.getClip();
+        const auto plot = [&canvas, &color, &clip, cx, cy](const int x, const int y) {
+          Circle::plotMirrored(canvas, color, clip, cx, cy, x, y);
+        };
+        int x = 0;
+        int y = r;
+        int d = 1 - r;
+        while(x <= y)
+        {
+          plot(x, y);
+          if(x != y) plot(y, x);
+          if(d < 0)
+          {
+            d += 2 * x + 3;
+          }
+          else
+          {
+            d += 2 * (x - y) + 5;
+            --y;
+          }
+          ++x;
+        }
       }
   };
 }
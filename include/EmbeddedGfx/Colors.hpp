@@ -1,7 +1,9 @@
 #ifndef EMBEDDED_GFX_COLOR_HPP
 #define EMBEDDED_GFX_COLOR_HPP
 
+#include <cstddef>
 #include <cstdint>
+#include <type_traits>
 
 namespace EmbeddedGfx
 { 
@@ -84,6 +86,67 @@ namespace EmbeddedGfx
       return ((red & green & blue) == 255);
     }
   };
+
+  /**
+   * Dithered black and white color representation.
+   * The value is the intensity of the color as the number of white
+   * pixels in every 8x8 block, from 0 to 64. The canvas turns it into
+   * ordered dither pattern of black and white pixels.
+   * 
+   */
+  struct Dithered: public Color
+  {
+    using Type = uint8_t;
+    static constexpr Type Levels = 64;
+    constexpr Dithered() { }
+    constexpr Dithered(const Color& color) : Color{color} { }
+    constexpr Type getValue() const
+    {
+      // luma with weights 77, 150 and 29 out of 256, scaled to the levels
+      const unsigned luma = (77u * red + 150u * green + 29u * blue) >> 8;
+      return static_cast<Type>((luma * (Levels + 1)) >> 8);
+    }
+  };
+
+  /**
+   * Palette index color representation.
+   * Uses Bits bits for the index of the color in the palette,
+   * the palette is applied when the canvas is sent to the display.
+   * 
+   */
+  template<uint8_t Bits>
+  struct Indexed
+  {
+    static_assert(Bits == 1 || Bits == 2 || Bits == 4 || Bits == 8, "Index must have 1, 2, 4 or 8 bits.");
+    using Type = uint8_t;
+    static constexpr size_t PaletteSize = size_t{1} << Bits;
+    uint8_t index;
+
+    constexpr Indexed() : Indexed{0} { }
+    constexpr Indexed(const uint8_t i) : index(i) { }
+    constexpr Type getValue() const
+    {
+      return static_cast<Type>(index & (PaletteSize - 1));
+    }
+  };
+
+  /**
+   * @brief The number of bits used by one pixel in the packed
+   * canvas layouts, 0 for colors which can't be packed.
+   * 
+   * @tparam ColorT The color representation type.
+   */
+  template<typename ColorT>
+  struct BitsPerPixel : std::integral_constant<size_t, 0> {};
+
+  template<>
+  struct BitsPerPixel<BlackAndWhite> : std::integral_constant<size_t, 1> {};
+
+  template<>
+  struct BitsPerPixel<Dithered> : std::integral_constant<size_t, 1> {};
+
+  template<uint8_t Bits>
+  struct BitsPerPixel<Indexed<Bits>> : std::integral_constant<size_t, Bits> {};
 }
 
 #endif //EMBEDDED_GFX_COLOR_HPP
\ No newline at end of file
@@ -0,0 +1,309 @@
+#ifndef EMBEDDED_GFX_DIRTY_REGION_HPP
+#define EMBEDDED_GFX_DIRTY_REGION_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "Rect.hpp"
+
+namespace EmbeddedGfx
+{
+  /**
+   * @brief Bounded list of rectangles covering the modified
+   * parts of a canvas.
+   * 
+   * Overlapping and adjacent rectangles are merged. When the list
+   * is full, the new rectangle is merged with the one that grows
+   * the least, so the region never loses modified pixels.
+   * 
+   * @tparam MaxRects The maximum number of separate rectangles.
+   */
+  template <size_t MaxRects>
+  class DirtyRegion
+  {
+    static_assert(MaxRects > 0, "Dirty region must hold at least one rectangle.");
+    public:
+      using RectsT = std::array<Rect, MaxRects>;
+      using ConstIteratorT = typename RectsT::const_iterator;
+
+      /**
+       * @brief Add modified area to the region.
+       * 
+       * @param rect The modified area.
+       */
+      void add(const Rect& rect)
+      {
+        if(rect.isEmpty()) return;
+        for(size_t i = 0; i < count_; ++i)
+        {
+          if(rects_[i].contains(rect)) return;
+        }
+        size_t target = count_;
+        for(size_t i = 0; i < count_; ++i)
+        {
+          if(rects_[i].touches(rect))
+          {
+            target = i;
+            break;
+          }
+        }
+        if(target == count_ && count_ == MaxRects)
+        {
+          // no free slot, grow the rectangle that expands the least
+          long smallestGrowth = 0;
+          for(size_t i = 0; i < count_; ++i)
+          {
+            const long growth = rects_[i].united(rect).getArea() - rects_[i].getArea();
+            if(i == 0 || growth < smallestGrowth)
+            {
+              smallestGrowth = growth;
+              target = i;
+            }
+          }
+        }
+        if(target == count_)
+        {
+          rects_[count_++] = rect;
+          return;
+        }
+        rects_[target] = rects_[target].united(rect);
+        coalesce(target);
+      }
+
+      /**
+       * @brief Remove all rectangles from the region.
+       * 
+       */
+      void clear()
+      {
+        count_ = 0;
+      }
+
+      /**
+       * @brief Check if nothing was modified.
+       */
+      bool isEmpty() const { return count_ == 0; }
+
+      /**
+       * @brief Get the number of rectangles in the region.
+       */
+      size_t size() const { return count_; }
+
+      /**
+       * @brief Get the bounding box of the whole region.
+       */
+      Rect getBounds() const
+      {
+        Rect bounds{};
+        for(size_t i = 0; i < count_; ++i) bounds = bounds.united(rects_[i]);
+        return bounds;
+      }
+
+      const Rect& operator[](const size_t index) const { return rects_[index]; }
+
+      ConstIteratorT begin() const { return rects_.cbegin(); }
+
+      ConstIteratorT end() const { return rects_.cbegin() + count_; }
+
+    private:
+      /**
+       * @brief Merge the rectangles touching the grown one, until none is left.
+       * 
+       * @param index The index of the grown rectangle.
+       */
+      void coalesce(size_t index)
+      {
+        for(size_t i = 0; i < count_; )
+        {
+          if(i != index && rects_[i].touches(rects_[index]))
+          {
+            rects_[index] = rects_[index].united(rects_[i]);
+            rects_[i] = rects_[--count_];
+            if(index == count_) index = i;
+            i = 0;
+          }
+          else
+          {
+            ++i;
+          }
+        }
+      }
+
+      RectsT rects_{};
+      size_t count_ = 0;
+  };
+
+  /**
+   * @brief Modified columns of page-organized buffer,
+   * as used by SSD1306 and similar controllers.
+   * 
+   * Every page (group of 8 rows) has a dirty bit and the range
+   * of modified columns, which maps directly to the page and
+   * column addressing commands of the controllers.
+   * 
+   * @tparam Pages The number of pages.
+   * @tparam Columns The number of columns.
+   */
+  template <size_t Pages, size_t Columns>
+  class PageDirtyRegion
+  {
+    public:
+      using PageMatrixT = std::array<std::array<uint8_t, Columns>, Pages>;
+
+      /**
+       * @brief Modified bytes of one page, ready to be
+       * sent after setting the page and column address.
+       * 
+       */
+      struct PageRun
+      {
+        size_t page;
+        size_t columnStart;
+        size_t columnEnd;      //< the last column, inclusive
+        const uint8_t* bytes;  //< the bytes from columnStart to columnEnd
+
+        size_t getLength() const { return columnEnd - columnStart + 1; }
+      };
+
+      /**
+       * @brief Iterator over the runs of the dirty pages.
+       * 
+       */
+      class ConstIterator
+      {
+        public:
+          ConstIterator(const PageDirtyRegion& region, const PageMatrixT& matrix, const size_t page)
+            : region_{&region}, matrix_{&matrix}, page_{page}
+          {
+            skipCleanPages();
+          }
+
+          PageRun operator*() const
+          {
+            const auto& [columnStart, columnEnd] = region_->getColumns(page_);
+            return {page_, columnStart, columnEnd, (*matrix_)[page_].data() + columnStart};
+          }
+
+          ConstIterator& operator++()
+          {
+            ++page_;
+            skipCleanPages();
+            return *this;
+          }
+
+          bool operator==(const ConstIterator& other) const { return page_ == other.page_; }
+
+          bool operator!=(const ConstIterator& other) const { return page_ != other.page_; }
+
+        private:
+          void skipCleanPages()
+          {
+            while(page_ < Pages && !region_->isPageDirty(page_)) ++page_;
+          }
+
+          const PageDirtyRegion* region_;
+          const PageMatrixT* matrix_;
+          size_t page_;
+      };
+
+      /**
+       * @brief Range of the runs of the dirty pages.
+       * 
+       */
+      class Runs
+      {
+        public:
+          Runs(const PageDirtyRegion& region, const PageMatrixT& matrix)
+            : region_{region}, matrix_{matrix}
+          {
+          }
+
+          ConstIterator begin() const { return {region_, matrix_, 0}; }
+
+          ConstIterator end() const { return {region_, matrix_, Pages}; }
+
+        private:
+          const PageDirtyRegion& region_;
+          const PageMatrixT& matrix_;
+      };
+
+      /**
+       * @brief Get the modified bytes of every dirty page.
+       * 
+       * @param matrix The page matrix the region belongs to.
+       * @return Runs Range with one run per dirty page.
+       */
+      Runs getRuns(const PageMatrixT& matrix) const
+      {
+        return {*this, matrix};
+      }
+
+      /**
+       * @brief Mark columns of the page as modified.
+       * 
+       * @param page The index of the page.
+       * @param columnStart The first modified column.
+       * @param columnEnd The last modified column, inclusive.
+       */
+      void add(const size_t page, const size_t columnStart, const size_t columnEnd)
+      {
+        if(isPageDirty(page))
+        {
+          columns_[page].first = std::min(columns_[page].first, columnStart);
+          columns_[page].second = std::max(columns_[page].second, columnEnd);
+        }
+        else
+        {
+          pageMask_[page / MaskBits] |= (MaskT{1} << (page % MaskBits));
+          columns_[page] = {columnStart, columnEnd};
+        }
+      }
+
+      /**
+       * @brief Mark the whole buffer as modified.
+       * 
+       */
+      void addAll()
+      {
+        for(size_t page = 0; page < Pages; ++page) add(page, 0, Columns - 1);
+      }
+
+      /**
+       * @brief Mark all pages as not modified.
+       * 
+       */
+      void clear()
+      {
+        pageMask_.fill(0);
+      }
+
+      /**
+       * @brief Check if the page contains modified columns.
+       */
+      bool isPageDirty(const size_t page) const
+      {
+        return pageMask_[page / MaskBits] & (MaskT{1} << (page % MaskBits));
+      }
+
+      /**
+       * @brief Get the first and the last modified column of the page.
+       * Valid only for dirty pages.
+       */
+      const std::pair<size_t, size_t>& getColumns(const size_t page) const
+      {
+        return columns_[page];
+      }
+
+    private:
+      using MaskT = uint32_t;
+      static constexpr size_t MaskBits = 32;
+
+      std::array<MaskT, (Pages + MaskBits - 1) / MaskBits> pageMask_{};
+      std::array<std::pair<size_t, size_t>, Pages> columns_{};
+  };
+}
+
+#endif // EMBEDDED_GFX_DIRTY_REGION_HPP
@@ -0,0 +1,145 @@
+#ifndef EMBEDDED_GFX_DITHER_HPP
+#define EMBEDDED_GFX_DITHER_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace EmbeddedGfx
+{
+  /**
+   * @brief Compile time generator of the 8x8 Bayer matrix and of the
+   * dither patterns of whole bytes.
+   * 
+   */
+  struct BayerMatrix
+  {
+    static constexpr size_t Size = 8;
+    static constexpr uint8_t Levels = Size * Size;
+    using MatrixT = std::array<std::array<uint8_t, Size>, Size>;
+    using PatternsT = std::array<std::array<uint8_t, Size>, Levels + 1>;
+
+    /**
+     * @brief Make the matrix of thresholds 0 to 63, where every level
+     * adds the pixel farthest from the pixels which are already on.
+     * 
+     * @return MatrixT The thresholds, indexed by row and column.
+     */
+    static constexpr MatrixT makeThresholds()
+    {
+      MatrixT matrix{};
+      for(size_t y = 0; y < Size; ++y)
+      {
+        for(size_t x = 0; x < Size; ++x)
+        {
+          // interleave the bits of x ^ y and y in reverse order
+          const size_t mixed = x ^ y;
+          uint8_t value = 0;
+          for(size_t bit = 0; bit < 3; ++bit)
+          {
+            value = static_cast<uint8_t>((value << 2) | (((mixed >> bit) & 1) << 1) | ((y >> bit) & 1));
+          }
+          matrix[y][x] = value;
+        }
+      }
+      return matrix;
+    }
+
+    /**
+     * @brief Make the byte patterns of all levels.
+     * 
+     * @tparam Rows Bytes hold horizontal pixels, otherwise vertical ones.
+     * @tparam MsbFirst The first pixel is in the MSB.
+     * @return PatternsT The patterns, indexed by level and by the row
+     * or the column within the matrix.
+     */
+    template<bool Rows, bool MsbFirst>
+    static constexpr PatternsT makePatterns()
+    {
+      const MatrixT matrix = makeThresholds();
+      PatternsT patterns{};
+      for(size_t level = 0; level <= Levels; ++level)
+      {
+        for(size_t line = 0; line < Size; ++line)
+        {
+          uint8_t pattern = 0;
+          for(size_t i = 0; i < Size; ++i)
+          {
+            const uint8_t threshold = Rows ? matrix[line][i] : matrix[i][line];
+            if(level > threshold) pattern |= static_cast<uint8_t>(MsbFirst ? (0x80 >> i) : (1 << i));
+          }
+          patterns[level][line] = pattern;
+        }
+      }
+      return patterns;
+    }
+  };
+
+  /**
+   * @brief Ordered dithering with 8x8 Bayer matrix.
+   * 
+   * Level L, from 0 to 64, turns on the pixels whose threshold
+   * is lower than L. The patterns of whole bytes are computed at
+   * compile time, so filling spans costs one table lookup per byte
+   * of the packed and the page layouts.
+   * 
+   */
+  struct OrderedDither
+  {
+    static constexpr size_t Size = BayerMatrix::Size;
+    static constexpr uint8_t Levels = BayerMatrix::Levels;
+
+    /**
+     * @brief Check if the pixel is on for the given level.
+     * 
+     * @param x The x-coordinate of the pixel.
+     * @param y The y-coordinate of the pixel.
+     * @param level The intensity level, from 0 to 64.
+     */
+    static constexpr bool isSet(const size_t x, const size_t y, const uint8_t level)
+    {
+      return level > thresholds[y % Size][x % Size];
+    }
+
+    /**
+     * @brief Get the pattern of 8 horizontal pixels starting at the
+     * column multiple of 8, for the packed layouts.
+     * 
+     * @tparam MsbFirst The leftmost pixel is in the MSB.
+     * @param y The y-coordinate of the pixels.
+     * @param level The intensity level, from 0 to 64.
+     */
+    template<bool MsbFirst>
+    static constexpr uint8_t getRow(const size_t y, const uint8_t level)
+    {
+      if constexpr(MsbFirst)
+      {
+        return rowsMsbFirst[level][y % Size];
+      }
+      else
+      {
+        return rowsLsbFirst[level][y % Size];
+      }
+    }
+
+    /**
+     * @brief Get the pattern of 8 vertical pixels starting at the
+     * row multiple of 8, for the page layout.
+     * 
+     * @param x The x-coordinate of the pixels.
+     * @param level The intensity level, from 0 to 64.
+     */
+    static constexpr uint8_t getColumn(const size_t x, const uint8_t level)
+    {
+      return columns[level][x % Size];
+    }
+
+    private:
+      static constexpr BayerMatrix::MatrixT thresholds = BayerMatrix::makeThresholds();
+      static constexpr BayerMatrix::PatternsT rowsMsbFirst = BayerMatrix::makePatterns<true, true>();
+      static constexpr BayerMatrix::PatternsT rowsLsbFirst = BayerMatrix::makePatterns<true, false>();
+      static constexpr BayerMatrix::PatternsT columns = BayerMatrix::makePatterns<false, false>();
+  };
+}
+
+#endif //EMBEDDED_GFX_DITHER_HPP
@@ -1,6 +1,11 @@
 #ifndef EMBEDDED_GFX_DRAWABLE
 #define EMBEDDED_GFX_DRAWABLE
 
+#include <type_traits>
+#include <utility>
+
+#include "Rect.hpp"
+
 namespace EmbeddedGfx
 {
   /**
@@ -19,7 +24,50 @@ namespace EmbeddedGfx
        * @param canvas Reference to the canvas.
        */
       virtual void draw(CanvasT& canvas) const = 0;
+
+      /**
+       * @brief Get the smallest rectangle containing all the pixels
+       * the object draws. Objects which don't know their extent are
+       * unbounded, so they are redrawn with every damaged area.
+       * 
+       * @return Rect The bounding box of the object.
+       */
+      virtual Rect getBounds() const
+      {
+        return Rect::unbounded();
+      }
   };
+
+  /**
+   * @brief Check if the type can be drawn on the canvas, which
+   * means it has method draw(CanvasT&) const. The type doesn't
+   * have to derive from Drawable.
+   * 
+   * @tparam T The type to check.
+   * @tparam CanvasT Type of the canvas.
+   */
+  template<typename T, typename CanvasT, typename = void>
+  struct IsDrawable : std::false_type {};
+
+  template<typename T, typename CanvasT>
+  struct IsDrawable<T, CanvasT, std::void_t<decltype(std::declval<const T&>().draw(std::declval<CanvasT&>()))>>
+    : std::true_type {};
+
+  /**
+   * @brief Draw object whose exact type is known, without virtual
+   * dispatch, so the drawing can be inlined into the canvas.
+   * 
+   * @tparam T The exact type of the object, not one of its bases,
+   * which is always the case for final classes.
+   * @tparam CanvasT Type of the canvas.
+   * @param drawable Reference to the object.
+   * @param canvas Reference to the canvas.
+   */
+  template<typename T, typename CanvasT>
+  inline void drawStatic(const T& drawable, CanvasT& canvas)
+  {
+    drawable.T::draw(canvas);
+  }
 }
 
-#endif //EMBEDDED_GFX_DRAWABLE
\ No newline at end of file
+#endif //EMBEDDED_GFX_DRAWABLE
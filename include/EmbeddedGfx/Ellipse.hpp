@@ -1,8 +1,9 @@
 #ifndef EMBEDDED_GFX_ELLIPSE_HPP
 #define EMBEDDED_GFX_ELLIPSE_HPP
 
+#include <algorithm>
 #include <cstddef>
-#include <cmath>
+#include <cstdint>
 
 #include "Vector2D.hpp"
 #include "Shape.hpp"
@@ -14,11 +15,15 @@ namespace EmbeddedGfx
    * @brief Class representing Ellipse.
    * 
    * @tparam CanvasT The type of the canvas.
+   * @tparam CoordinateT The type of the coordinates, for example float,
+   * int or fixed-point type.
    */
-  template <typename CanvasT>
+  template <typename CanvasT, typename CoordinateT = float>
   class Ellipse : public Shape<CanvasT>
   {
     public:
+      using PointT = Vector2D<CoordinateT>;
+
       /**
        * @brief Construct a new Ellipse object.
        * 
@@ -27,7 +32,7 @@ namespace EmbeddedGfx
        * @param a Half of the length of the major axis.
        * @param b Half of the length of the minor axis.
        */
-      Ellipse(float x = {}, float y = {}, float a = {}, float b = {})
+      constexpr Ellipse(CoordinateT x = {}, CoordinateT y = {}, CoordinateT a = {}, CoordinateT b = {})
         : centerPoint_{x, y}
         , a_ (a)
         , b_ (b)
@@ -41,7 +46,7 @@ namespace EmbeddedGfx
        * @param a Half of the length of the major axis.
        * @param b Half of the length of the minor axis.
        */
-      Ellipse(const Vector2Df& centerPoint, float a, float b)
+      constexpr Ellipse(const PointT& centerPoint, CoordinateT a, CoordinateT b)
         : centerPoint_{centerPoint}
         , a_ (a)
         , b_ (b)
@@ -55,59 +60,190 @@ namespace EmbeddedGfx
        */
       void draw(CanvasT& canvas) const override
       {
+        if(!getBounds().intersects(canvas.getClip())) return;
         if(this->fillColor_)
         {
-          const size_t yLow = (centerPoint_.y - b_ > 0) ? std::roundf(centerPoint_.y - b_) : 0;
-          const size_t yHigh = (centerPoint_.y + b_ <= canvas.getHeight() - 1) ? std::roundf(centerPoint_.y + b_) : canvas.getHeight() - 1;
-          const size_t xLow = (centerPoint_.x - a_ > 0) ? std::roundf(centerPoint_.x - a_) : 0;
-          const size_t xHigh = (centerPoint_.x + a_ <= canvas.getWidth() - 1) ? std::roundf(centerPoint_.x + a_) : canvas.getWidth() - 1;
-          const size_t aSquared = std::roundf(a_ * a_);
-          const size_t bSquared = std::roundf(b_ * b_);
-          const auto centerRoundedFloat = centerPoint_.rounded();
-          const Vector2D<size_t> centerRounded{
-              static_cast<size_t>(centerRoundedFloat.x)
-            , static_cast<size_t>(centerRoundedFloat.y)
-          };
-          for(size_t y = yLow; y <= yHigh; ++y)
+          drawFill(canvas);
+        }
+        if(this->outlineColor_)
+        {
+          drawOutline(canvas);
+        }
+      }
+
+      /**
+       * @brief Get the smallest rectangle containing all the pixels of the ellipse.
+       * 
+       * @return Rect The bounding box.
+       */
+      Rect getBounds() const override
+      {
+        const int cx = roundCoordinate(centerPoint_.x);
+        const int cy = roundCoordinate(centerPoint_.y);
+        const int a = std::max(roundCoordinate(a_), 0);
+        const int b = std::max(roundCoordinate(b_), 0);
+        return {cx - a, cy - b, cx + a + 1, cy + b + 1};
+      }
+    protected:
+      /**
+       * @brief Fill the inside of the ellipse.
+       * 
+       * The half-width of the ellipse is tracked from row to row,
+       * starting from the center, and every row is filled with single
+       * span. The boundary only moves inward, so the whole fill costs
+       * O(a + b) steps besides the spans themselves. Only the rows
+       * inside the clip area are walked.
+       * 
+       * @param canvas Reference to the canvas.
+       */
+      void drawFill(CanvasT& canvas) const
+      {
+        const int cx = roundCoordinate(centerPoint_.x);
+        const int cy = roundCoordinate(centerPoint_.y);
+        const int a = roundCoordinate(a_);
+        const int b = roundCoordinate(b_);
+        if(a <= 0 || b <= 0) return;
+        const auto& color = *(this->fillColor_);
+        const int64_t aSquared = static_cast<int64_t>(a) * a;
+        const int64_t bSquared = static_cast<int64_t>(b) * b;
+        // distances from the center of the first and past the last row inside the clip
+        const Rect& clip = canvas.getClip();
+        const int yFirst = (clip.y0 > cy) ? clip.y0 - cy : ((clip.y1 <= cy) ? cy - clip.y1 + 1 : 0);
+        const int yEnd = std::min(std::max(cy - clip.y0, clip.y1 - 1 - cy) + 1, b);
+        // the point (x, y) is inside when b^2*x^2 + a^2*y^2 - a^2*b^2 < 0
+        int x = a;
+        int64_t f = aSquared * yFirst * yFirst;  //< value of the expression for (x, y)
+        for(int y = yFirst; y < yEnd; ++y)
+        {
+          while(x >= 0 && f >= 0)
           {
-            const size_t yShifted = y - static_cast<size_t>(centerRounded.y);
-            const size_t yShiftedSquared = yShifted * yShifted;
-            for(size_t x = xLow; x <= xHigh; ++x)
-            {
-              const size_t xShifted = x - centerRounded.x;
-              const size_t xShiftedSquared = xShifted * xShifted;
-              if(this->fillColor_)
-              {
-                if(bSquared * xShiftedSquared + aSquared * yShiftedSquared < aSquared * bSquared)
-                {
-                  canvas.setPixel(x, y, *(this->fillColor_));
-                }
-              }
-            }
+            f -= bSquared * (2 * x - 1);
+            --x;
           }
+          if(x < 0) break;
+          if(isRowInside(clip, cy + y)) canvas.drawHSpanRaw(cx - x, cy + y, 2 * x + 1, color);
+          if(y != 0 && isRowInside(clip, cy - y)) canvas.drawHSpanRaw(cx - x, cy - y, 2 * x + 1, color);
+          f += aSquared * (2 * y + 1);
         }
-        if(this->outlineColor_)
+      }
+
+      /**
+       * @brief Draw the outline of the ellipse with the integer
+       * midpoint algorithm. One quadrant is computed and mirrored
+       * to the other three. The points in the rows outside of the
+       * clip area are skipped.
+       * 
+       * @param canvas Reference to the canvas.
+       */
+      void drawOutline(CanvasT& canvas) const
+      {
+        const int cx = roundCoordinate(centerPoint_.x);
+        const int cy = roundCoordinate(centerPoint_.y);
+        const int a = roundCoordinate(a_);
+        const int b = roundCoordinate(b_);
+        const auto& color = *(this->outlineColor_);
+        if(a <= 0 || b <= 0)
         {
-          static constexpr float PI = 3.14159265358979323846f;
-          static constexpr float deltaThetaDeg = 0.1f;  //< theta increment in degrees
-          static constexpr float deltaTheta = deltaThetaDeg * PI / 180.0f;
-          
-          Vector2Df point{};
-          Vector2Df pointRounded{};
-          float theta = 0.0f;
-          while(theta < 2 * PI)
+          // degenerated ellipse
+          canvas.fillRectRaw(cx - std::max(a, 0), cy - std::max(b, 0)
+                           , 2 * std::max(a, 0) + 1, 2 * std::max(b, 0) + 1, color);
+          return;
+        }
+        const Rect& clip = canvas.getClip();
+        // the rows above the clip are not reached any more once y is below this
+        const int yFirst = (clip.y0 > cy) ? clip.y0 - cy : ((clip.y1 <= cy) ? cy - clip.y1 + 1 : 0);
+        // decision variables are scaled by 4 to stay in integers
+        const int64_t aSquared = static_cast<int64_t>(a) * a;
+        const int64_t bSquared = static_cast<int64_t>(b) * b;
+        int x = 0;
+        int y = b;
+        int64_t dx = 0;
+        int64_t dy = 2 * aSquared * y;
+        // region 1, slope of the curve is less than 1
+        int64_t d = 4 * bSquared - 4 * aSquared * b + aSquared;
+        while(dx < dy)
+        {
+          if(y < yFirst) return;
+          plotMirrored(canvas, color, clip, cx, cy, x, y);
+          ++x;
+          dx += 2 * bSquared;
+          if(d < 0)
+          {
+            d += 4 * (dx + bSquared);
+          }
+          else
+          {
+            --y;
+            dy -= 2 * aSquared;
+            d += 4 * (dx - dy + bSquared);
+          }
+        }
+        // region 2, slope of the curve is greater than 1
+        d = bSquared * (4 * static_cast<int64_t>(x) * x + 4 * x + 1)
+          + 4 * aSquared * (static_cast<int64_t>(y) - 1) * (y - 1)
+          - 4 * aSquared * bSquared;
+        while(y > 0)
+        {
+          if(y < yFirst) return;
+          plotMirrored(canvas, color, clip, cx, cy, x, y);
+          --y;
+          dy -= 2 * aSquared;
+          if(d > 0)
           {
-            point.x = centerPoint_.x + a_ * std::cos(theta);
-            point.y = centerPoint_.y + b_ * std::sin(theta);
-            pointRounded = point.rounded();
-            canvas.setPixel(pointRounded.x, pointRounded.y, *(this->outlineColor_));
-            theta += deltaTheta;
+            d += 4 * (aSquared - dy);
           }
+          else
+          {
+            ++x;
+            dx += 2 * bSquared;
+            d += 4 * (dx - dy + aSquared);
+          }
+        }
+        // the flat ellipses reach the row of the center before x reaches a,
+        // the rest of the row is drawn up to the extremes
+        if(!isRowInside(clip, cy)) return;
+        if(x == 0)
+        {
+          canvas.drawHSpanRaw(cx - a, cy, 2 * a + 1, color);
+        }
+        else
+        {
+          canvas.drawHSpanRaw(cx + x, cy, a - x + 1, color);
+          canvas.drawHSpanRaw(cx - a, cy, a - x + 1, color);
+        }
+      }
+
+      /**
+       * @brief Check if the row is inside the clip area.
+       */
+      static constexpr bool isRowInside(const Rect& clip, const int y)
+      {
+        return y >= clip.y0 && y < clip.y1;
+      }
+
+      /**
+       * @brief Draw the point (x, y) relative to the center, mirrored
+       * to the other three quadrants. The rows outside of the clip area
+       * are skipped and the mirrored points on the axes, which are the
+       * same pixel, are written once.
+       */
+      static void plotMirrored(CanvasT& canvas, const typename CanvasT::PixelT color, const Rect& clip
+                             , const int cx, const int cy, const int x, const int y)
+      {
+        if(isRowInside(clip, cy + y))
+        {
+          canvas.setPixelRaw(cx + x, cy + y, color);
+          if(x != 0) canvas.setPixelRaw(cx - x, cy + y, color);
+        }
+        if(y != 0 && isRowInside(clip, cy - y))
+        {
+          canvas.setPixelRaw(cx + x, cy - y, color);
+          if(x != 0) canvas.setPixelRaw(cx - x, cy - y, color);
         }
       }
-    private:
-      Vector2Df centerPoint_;
-      float a_, b_;
+    protected:
+      PointT centerPoint_;
+      CoordinateT a_, b_;
   };
 }
 
@@ -0,0 +1,100 @@
+#ifndef EMBEDDED_GFX_FILL_HPP
+#define EMBEDDED_GFX_FILL_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace EmbeddedGfx
+{
+  /**
+   * @brief Fill run of pixels with the same value using wide stores.
+   * 
+   * The value is replicated into a 16 byte pattern and, after the
+   * unaligned head, the run is written in aligned blocks: SSE2 or NEON
+   * registers when the target has them, otherwise words of the native
+   * size of the target, for example 32 bits on Cortex-M. Pixels which
+   * are not 1, 2 or 4 bytes wide are filled with std::fill_n.
+   * 
+   * @tparam PixelT The type of the pixel value.
+   * @param pixels Pointer to the first pixel of the run.
+   * @param count The number of pixels in the run.
+   * @param value The value of the pixels.
+   */
+  template<typename PixelT>
+  inline void fillPixels(PixelT* pixels, size_t count, const PixelT value)
+  {
+    constexpr size_t size = sizeof(PixelT);
+    constexpr size_t blockSize = 16;
+    if constexpr(!std::is_trivially_copyable_v<PixelT> || (blockSize % size) != 0 || size > 4)
+    {
+      std::fill_n(pixels, count, value);
+    }
+    else
+    {
+      // the head is written pixel by pixel until the run is aligned
+      while(count > 0 && (reinterpret_cast<uintptr_t>(pixels) % blockSize) != 0)
+      {
+        *pixels++ = value;
+        --count;
+      }
+      unsigned char pattern[blockSize];
+      for(size_t i = 0; i < blockSize; i += size)
+      {
+        std::memcpy(pattern + i, &value, size);
+      }
+      auto* bytes = reinterpret_cast<unsigned char*>(pixels);
+      unsigned char* const end = bytes + (count * size) / blockSize * blockSize;
+#if defined(__SSE2__)
+      const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pattern));
+      for(; end - bytes >= static_cast<ptrdiff_t>(4 * blockSize); bytes += 4 * blockSize)
+      {
+        _mm_store_si128(reinterpret_cast<__m128i*>(bytes), block);
+        _mm_store_si128(reinterpret_cast<__m128i*>(bytes + blockSize), block);
+        _mm_store_si128(reinterpret_cast<__m128i*>(bytes + 2 * blockSize), block);
+        _mm_store_si128(reinterpret_cast<__m128i*>(bytes + 3 * blockSize), block);
+      }
+      for(; bytes != end; bytes += blockSize)
+      {
+        _mm_store_si128(reinterpret_cast<__m128i*>(bytes), block);
+      }
+#elif defined(__ARM_NEON)
+      const uint8x16_t block = vld1q_u8(pattern);
+      for(; end - bytes >= static_cast<ptrdiff_t>(4 * blockSize); bytes += 4 * blockSize)
+      {
+        vst1q_u8(bytes, block);
+        vst1q_u8(bytes + blockSize, block);
+        vst1q_u8(bytes + 2 * blockSize, block);
+        vst1q_u8(bytes + 3 * blockSize, block);
+      }
+      for(; bytes != end; bytes += blockSize)
+      {
+        vst1q_u8(bytes, block);
+      }
+#else
+      // words of the size of a pointer, the widest single store on most MCUs
+      using WordT = std::conditional_t<sizeof(void*) >= sizeof(uint64_t), uint64_t, uint32_t>;
+      WordT word;
+      std::memcpy(&word, pattern, sizeof(WordT));
+      for(; bytes != end; bytes += sizeof(WordT))
+      {
+        std::memcpy(bytes, &word, sizeof(WordT));
+      }
+#endif
+      // the tail is shorter than one block
+      pixels = reinterpret_cast<PixelT*>(bytes);
+      count -= (count * size) / blockSize * blockSize / size;
+      std::fill_n(pixels, count, value);
+    }
+  }
+}
+
+#endif //EMBEDDED_GFX_FILL_HPP
@@ -0,0 +1,220 @@
+#ifndef EMBEDDED_GFX_FIXED_HPP
+#define EMBEDDED_GFX_FIXED_HPP
+
+#include <cstdint>
+#include <type_traits>
+
+namespace EmbeddedGfx
+{
+  /**
+   * @brief Round floating point value to the nearest integer, halfway
+   * cases away from zero, like std::lround but usable in constant
+   * expressions.
+   * 
+   * @tparam IntT The type of the result.
+   * @param value The floating point value.
+   * @return IntT The nearest integer.
+   */
+  template<typename IntT, typename T>
+  constexpr IntT roundFloating(const T value)
+  {
+    const IntT truncated = static_cast<IntT>(value);
+    // the fractional part is exact, so the rounding matches std::lround
+    const T fraction = value - static_cast<T>(truncated);
+    if(fraction >= T{0.5}) return truncated + 1;
+    if(fraction <= T{-0.5}) return truncated - 1;
+    return truncated;
+  }
+
+  /**
+   * @brief Signed fixed-point number in Q format, stored in 32 bits.
+   * 
+   * All the arithmetic is done with integers, so coordinates of this
+   * type can be used on targets without FPU without any soft-float
+   * calls. Conversion from floating point values is provided for
+   * convenience and costs nothing only when it's done at compile time.
+   * 
+   * @tparam FractionBits The number of fractional bits.
+   */
+  template<int FractionBits>
+  class Fixed
+  {
+    static_assert(FractionBits > 0 && FractionBits < 31, "Fixed-point number must have 1 to 30 fractional bits.");
+    public:
+      using RawT = int32_t;
+      static constexpr int fractionBits = FractionBits;
+      static constexpr RawT One = RawT{1} << FractionBits;
+
+      constexpr Fixed() : raw_{0} {}
+
+      /**
+       * @brief Construct a new Fixed object from integer value.
+       * 
+       * @param value The integer value.
+       */
+      template<typename T, typename std::enable_if_t<std::is_integral_v<T>, int> = 0>
+      constexpr Fixed(const T value) : raw_{static_cast<RawT>(value * One)} {}
+
+      /**
+       * @brief Construct a new Fixed object from floating point value,
+       * rounded to the nearest representable value.
+       * 
+       * @param value The floating point value.
+       */
+      template<typename T, typename std::enable_if_t<std::is_floating_point_v<T>, int> = 0>
+      constexpr Fixed(const T value)
+        : raw_{roundFloating<RawT>(value * One)}
+      {
+      }
+
+      /**
+       * @brief Construct a new Fixed object from the raw value.
+       * 
+       * @param raw The value multiplied by 2^FractionBits.
+       */
+      static constexpr Fixed fromRaw(const RawT raw)
+      {
+        Fixed value;
+        value.raw_ = raw;
+        return value;
+      }
+
+      /**
+       * @brief Get the raw value, multiplied by 2^FractionBits.
+       */
+      constexpr RawT getRaw() const { return raw_; }
+
+      /**
+       * @brief Round to the nearest integer, halfway cases away from zero.
+       */
+      constexpr int round() const
+      {
+        constexpr RawT half = One / 2;
+        return (raw_ >= 0) ? static_cast<int>((raw_ + half) >> FractionBits)
+                           : -static_cast<int>((half - raw_) >> FractionBits);
+      }
+
+      /**
+       * @brief Convert to arithmetic type. Integers are
+       * truncated toward zero, as from floating point values.
+       */
+      template<typename T, typename std::enable_if_t<std::is_arithmetic_v<T>, int> = 0>
+      explicit constexpr operator T() const
+      {
+        if constexpr(std::is_floating_point_v<T>)
+        {
+          return static_cast<T>(raw_) / One;
+        }
+        else
+        {
+          return static_cast<T>(raw_ / One);
+        }
+      }
+
+      constexpr Fixed operator-() const { return fromRaw(-raw_); }
+
+      constexpr Fixed& operator+=(const Fixed value) { raw_ += value.raw_; return *this; }
+      constexpr Fixed& operator-=(const Fixed value) { raw_ -= value.raw_; return *this; }
+
+      constexpr Fixed& operator*=(const Fixed value)
+      {
+        raw_ = static_cast<RawT>((static_cast<int64_t>(raw_) * value.raw_) / One);
+        return *this;
+      }
+
+      constexpr Fixed& operator/=(const Fixed value)
+      {
+        raw_ = static_cast<RawT>((static_cast<int64_t>(raw_) * One) / value.raw_);
+        return *this;
+      }
+
+      friend constexpr Fixed operator+(Fixed lhs, const Fixed rhs) { return lhs += rhs; }
+      friend constexpr Fixed operator-(Fixed lhs, const Fixed rhs) { return lhs -= rhs; }
+      friend constexpr Fixed operator*(Fixed lhs, const Fixed rhs) { return lhs *= rhs; }
+      friend constexpr Fixed operator/(Fixed lhs, const Fixed rhs) { return lhs /= rhs; }
+
+      friend constexpr bool operator==(const Fixed lhs, const Fixed rhs) { return lhs.raw_ == rhs.raw_; }
+      friend constexpr bool operator!=(const Fixed lhs, const Fixed rhs) { return lhs.raw_ != rhs.raw_; }
+      friend constexpr bool operator<(const Fixed lhs, const Fixed rhs) { return lhs.raw_ < rhs.raw_; }
+      friend constexpr bool operator<=(const Fixed lhs, const Fixed rhs) { return lhs.raw_ <= rhs.raw_; }
+      friend constexpr bool operator>(const Fixed lhs, const Fixed rhs) { return lhs.raw_ > rhs.raw_; }
+      friend constexpr bool operator>=(const Fixed lhs, const Fixed rhs) { return lhs.raw_ >= rhs.raw_; }
+    private:
+      RawT raw_;
+  };
+
+  // aliases
+  using Q24_8 = Fixed<8>;
+  using Q16_16 = Fixed<16>;
+
+  /**
+   * @brief Check if the type is fixed-point number.
+   * 
+   * @tparam T The type to check.
+   */
+  template<typename T>
+  struct IsFixed : std::false_type {};
+
+  template<int FractionBits>
+  struct IsFixed<Fixed<FractionBits>> : std::true_type {};
+
+  /**
+   * @brief Round coordinate to the nearest integer, halfway
+   * cases away from zero, without floating point operations
+   * for integer and fixed-point coordinates.
+   * 
+   * @param value The coordinate.
+   * @return int The nearest integer.
+   */
+  template<typename T>
+  constexpr int roundCoordinate(const T value)
+  {
+    if constexpr(IsFixed<T>::value)
+    {
+      return value.round();
+    }
+    else if constexpr(std::is_floating_point_v<T>)
+    {
+      return roundFloating<int>(value);
+    }
+    else
+    {
+      return static_cast<int>(value);
+    }
+  }
+
+  /**
+   * @brief Convert coordinate to raw fixed-point value with
+   * the given number of fractional bits.
+   * 
+   * @tparam FractionBits The number of fractional bits of the result.
+   * @param value The coordinate.
+   * @return int32_t The value multiplied by 2^FractionBits.
+   */
+  template<int FractionBits, typename T>
+  constexpr int32_t coordinateToRaw(const T value)
+  {
+    constexpr int32_t one = int32_t{1} << FractionBits;
+    if constexpr(IsFixed<T>::value)
+    {
+      if constexpr(FractionBits >= T::fractionBits)
+      {
+        return value.getRaw() * (int32_t{1} << (FractionBits - T::fractionBits));
+      }
+      else
+      {
+        return value.getRaw() / (int32_t{1} << (T::fractionBits - FractionBits));
+      }
+    }
+    else if constexpr(std::is_floating_point_v<T>)
+    {
+      return roundFloating<int32_t>(value * one);
+    }
+    else
+    {
+      return static_cast<int32_t>(value) * one;
+    }
+  }
+}
+
+#endif //EMBEDDED_GFX_FIXED_HPP
@@ -1,11 +1,31 @@
 #ifndef EMBEDDED_GFX_FONT_HPP
 #define EMBEDDED_GFX_FONT_HPP
 
-#include <cstdint>
 #include <array>
+#include <cstddef>
+#include <cstdint>
 
 namespace EmbeddedGfx
 {
+  /**
+   * @brief Bitmap and metrics of one character of a font.
+   * 
+   * The bitmap is stored in pages of 8 rows, like the pages of SSD1306-like
+   * displays. Every page holds one byte per column with the top pixel in
+   * bit 0, and the pages follow each other from the top of the glyph.
+   */
+  struct Glyph
+  {
+    /// The bitmap, width bytes for every page of the font height.
+    const uint8_t* columns;
+    /// The number of columns of the bitmap.
+    uint8_t width;
+    /// The offset of the bitmap from the pen position.
+    int8_t left;
+    /// The distance of the pen position of the next character.
+    uint8_t advance;
+  };
+
   /**
    * @brief Class representing font.
    * 
@@ -24,8 +44,32 @@ namespace EmbeddedGfx
         return {};
       }
 
+      /**
+       * @brief Get the bitmap and the metrics of a character.
+       * 
+       * @param c The character.
+       * @return Glyph The empty glyph of the font size.
+       */
+      static constexpr Glyph getGlyph([[maybe_unused]] const char c)
+      {
+        return {empty.data(), Width, 0, Width};
+      }
+
+      /**
+       * @brief Get the adjustment of the distance between two characters.
+       * 
+       * @param left The first character.
+       * @param right The character following it.
+       * @return int The fixed width font has no kerning, always 0.
+       */
+      static constexpr int getKerning([[maybe_unused]] const char left, [[maybe_unused]] const char right)
+      {
+        return 0;
+      }
+
     private:
       static constexpr uint8_t table[1] = {0x00};
+      static constexpr std::array<uint8_t, Width * ((Height + 7) / 8)> empty{};
   };
 
   /**
@@ -43,16 +87,53 @@ namespace EmbeddedGfx
       static std::array<uint8_t, width> getCharacter(const char c)
       {
         std::array<uint8_t, width> element{};
-        for(size_t i = (static_cast<uint8_t>(c) - 32)*width, j = 0
-            ; i < (static_cast<size_t>(c) - 32)*width + width
-            ; ++i, ++j)
+        for(size_t i = getOffset(c), j = 0; j < width; ++i, ++j)
         {
           element[j] = table[i];
         }
         return element;
       }
 
+      /**
+       * @brief Get the bitmap and the metrics of a character without
+       * copying the columns. The columns have the layout of the pages
+       * of SSD1306-like displays.
+       * 
+       * @param c The character. The characters outside of the ASCII range
+       * 32 to 127, like control characters or bytes of UTF-8 sequences,
+       * are drawn as space.
+       * @return Glyph The glyph pointing to the width bytes in the table.
+       */
+      static constexpr Glyph getGlyph(const char c)
+      {
+        return {&table[getOffset(c)], width, 0, width};
+      }
+
+      /**
+       * @brief Get the adjustment of the distance between two characters.
+       * 
+       * @param left The first character.
+       * @param right The character following it.
+       * @return int The fixed width font has no kerning, always 0.
+       */
+      static constexpr int getKerning([[maybe_unused]] const char left, [[maybe_unused]] const char right)
+      {
+        return 0;
+      }
+
     private:
+      static constexpr uint8_t first = 32;
+      static constexpr uint8_t last = 127;
+
+      /**
+       * @brief Get the index of the first column of the character in the table.
+       */
+      static constexpr size_t getOffset(const char c)
+      {
+        const uint8_t code = static_cast<uint8_t>(c);
+        return (code >= first && code <= last) ? (code - first) * size_t{width} : 0;
+      }
+
       static constexpr uint8_t table[] =
       {
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // sp (space, ascii table position: 32)
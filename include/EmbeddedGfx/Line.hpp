@@ -1,7 +1,11 @@
 #ifndef EMBEDDED_GFX_LINE_HPP
 #define EMBEDDED_GFX_LINE_HPP
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <utility>
 
 #include "Drawable.hpp"
 #include "Vector2D.hpp"
@@ -12,12 +16,16 @@ namespace EmbeddedGfx
    * @brief Class representing Line.
    * 
    * @tparam CanvasT The type of the canvas.
+   * @tparam CoordinateT The type of the coordinates, for example float,
+   * int or fixed-point type.
    */
-  template <typename CanvasT>
-  class Line : public Drawable<CanvasT>
+  template <typename CanvasT, typename CoordinateT = float>
+  class Line final : public Drawable<CanvasT>
   {
     public:
       using ColorT = typename CanvasT::ColorT;
+      using PixelT = typename CanvasT::PixelT;
+      using PointT = Vector2D<CoordinateT>;
     public:
       /**
        * @brief Construct a new Line object from the given coordinates.
@@ -27,10 +35,10 @@ namespace EmbeddedGfx
        * @param x2 The x-coordinate of the end point.
        * @param y2 The y-coordinate of the end point.
        */
-      Line(float x1 = {}, float y1 = {}, float x2 = {}, float y2 = {}, const ColorT& color = {})
+      constexpr Line(CoordinateT x1 = {}, CoordinateT y1 = {}, CoordinateT x2 = {}, CoordinateT y2 = {}, const ColorT& color = {})
         : startPoint_{x1, y1}
         , endPoint_{x2, y2}
-        , color_{color}
+        , color_{color.getValue()}
       {
       }
 
@@ -40,16 +48,16 @@ namespace EmbeddedGfx
        * @param startPoint Vector holding the coordinates of the start point.
        * @param endPoint Vector holding the coordinates of the end point.
        */
-      Line(const Vector2Df& startPoint, const Vector2Df& endPoint, const ColorT& color = {})
+      constexpr Line(const PointT& startPoint, const PointT& endPoint, const ColorT& color = {})
         : startPoint_ {startPoint}
         , endPoint_ {endPoint}
-        , color_{color}
+        , color_{color.getValue()}
       {
       }
 
-      void setColor(const ColorT& color)
+      constexpr void setColor(const ColorT& color)
       {
-        color_ = color;
+        color_ = color.getValue();
       }
 
       /**
@@ -59,23 +67,136 @@ namespace EmbeddedGfx
        */
       void draw(CanvasT& canvas) const override
       {
-        Vector2Df k = (endPoint_ - startPoint_).unit();
-        Vector2Df temp(startPoint_);
-        Vector2Df tempRounded = temp.rounded();
-        canvas.setPixel(tempRounded.x, tempRounded.y, color_);
-        while(tempRounded != endPoint_)
+        if(!getBounds().intersects(canvas.getClip())) return;
+        drawLine(canvas, startPoint_, endPoint_, color_);
+      }
+
+      /**
+       * @brief Get the smallest rectangle containing all the pixels of the line.
+       * 
+       * @return Rect The bounding box.
+       */
+      Rect getBounds() const override
+      {
+        const int x0 = roundCoordinate(startPoint_.x);
+        const int y0 = roundCoordinate(startPoint_.y);
+        const int x1 = roundCoordinate(endPoint_.x);
+        const int y1 = roundCoordinate(endPoint_.y);
+        return {std::min(x0, x1), std::min(y0, y1), std::max(x0, x1) + 1, std::max(y0, y1) + 1};
+      }
+
+      /**
+       * @brief Draw line between two points without creating Line object.
+       * 
+       * Uses integer Bresenham algorithm. The pixels are emitted as
+       * runs along the major axis, so horizontal and vertical lines
+       * end up as single span. The steps outside of the clip area
+       * along the major axis are skipped, not iterated.
+       * 
+       * @param canvas Reference to the canvas.
+       * @param startPoint Vector holding the coordinates of the start point.
+       * @param endPoint Vector holding the coordinates of the end point.
+       * @param pixel The encoded value of the pixels.
+       */
+      static void drawLine(CanvasT& canvas, const PointT& startPoint, const PointT& endPoint, const PixelT pixel)
+      {
+        int x0 = roundCoordinate(startPoint.x);
+        int y0 = roundCoordinate(startPoint.y);
+        int x1 = roundCoordinate(endPoint.x);
+        int y1 = roundCoordinate(endPoint.y);
+        const int dx = std::abs(x1 - x0);
+        const int dy = std::abs(y1 - y0);
+        const Rect& clip = canvas.getClip();
+        if(dx >= dy)
+        {
+          // x-major line, always walk from left to right
+          if(x0 > x1)
+          {
+            std::swap(x0, x1);
+            std::swap(y0, y1);
+          }
+          const int sy = (y1 >= y0) ? 1 : -1;
+          const int xStart = std::max(x0, clip.x0);
+          const int xEnd = std::min(x1, clip.x1 - 1);
+          if(xStart > xEnd) return;
+          const int skipped = minorSteps(xStart - x0, dx, dy);
+          int error = errorAt(xStart - x0, skipped, dx, dy);
+          int runStart = xStart;
+          int y = y0 + sy * skipped;
+          for(int x = xStart; x != xEnd; ++x)
+          {
+            if(error > 0)
+            {
+              canvas.drawHSpanRaw(runStart, y, x - runStart + 1, pixel);
+              runStart = x + 1;
+              y += sy;
+              error -= 2 * dx;
+            }
+            error += 2 * dy;
+          }
+          canvas.drawHSpanRaw(runStart, y, xEnd - runStart + 1, pixel);
+        }
+        else
         {
-          temp += k;
-          tempRounded = temp.rounded();
-          canvas.setPixel(tempRounded.x, tempRounded.y, color_);
+          // y-major line, always walk from top to bottom
+          if(y0 > y1)
+          {
+            std::swap(x0, x1);
+            std::swap(y0, y1);
+          }
+          const int sx = (x1 >= x0) ? 1 : -1;
+          const int yStart = std::max(y0, clip.y0);
+          const int yEnd = std::min(y1, clip.y1 - 1);
+          if(yStart > yEnd) return;
+          const int skipped = minorSteps(yStart - y0, dy, dx);
+          int error = errorAt(yStart - y0, skipped, dy, dx);
+          int runStart = yStart;
+          int x = x0 + sx * skipped;
+          for(int y = yStart; y != yEnd; ++y)
+          {
+            if(error > 0)
+            {
+              canvas.drawVSpanRaw(x, runStart, y - runStart + 1, pixel);
+              runStart = y + 1;
+              x += sx;
+              error -= 2 * dy;
+            }
+            error += 2 * dx;
+          }
+          canvas.drawVSpanRaw(x, runStart, yEnd - runStart + 1, pixel);
         }
-        tempRounded = endPoint_.rounded();
-        canvas.setPixel(tempRounded.x, tempRounded.y, color_);
       }
+
     private:
-      Vector2Df startPoint_;
-      Vector2Df endPoint_;
-      ColorT color_ = {};
+      /**
+       * @brief Compute the number of steps along the minor axis which
+       * the Bresenham algorithm makes before the given major axis step.
+       * 
+       * @param step The index of the step along the major axis.
+       * @param dMajor The length of the line along the major axis.
+       * @param dMinor The length of the line along the minor axis.
+       */
+      static int minorSteps(const int step, const int dMajor, const int dMinor)
+      {
+        const int64_t numerator = 2 * static_cast<int64_t>(dMinor) * step - dMajor;
+        if(numerator <= 0) return 0;
+        const int64_t denominator = 2 * static_cast<int64_t>(dMajor);
+        return static_cast<int>((numerator + denominator - 1) / denominator);
+      }
+
+      /**
+       * @brief Compute the decision variable of the Bresenham
+       * algorithm at the given major axis step.
+       */
+      static int errorAt(const int step, const int taken, const int dMajor, const int dMinor)
+      {
+        return static_cast<int>(2 * static_cast<int64_t>(dMinor) * (step + 1) - dMajor
+                              - 2 * static_cast<int64_t>(dMajor) * taken);
+      }
+
+      PointT startPoint_;
+      PointT endPoint_;
+      PixelT color_ = {};
   };
 }
 
@@ -0,0 +1,62 @@
+#ifndef EMBEDDED_GFX_MATRIX_VIEW_HPP
+#define EMBEDDED_GFX_MATRIX_VIEW_HPP
+
+#include <cstddef>
+
+namespace EmbeddedGfx
+{
+  /**
+   * @brief Matrix of Rows x Columns elements over memory owned by someone
+   * else, for example over a line buffer of AsyncFlush.
+   * 
+   * The rows are indexed like the rows of std::array of std::array,
+   * but all of them are parts of one flat run of elements, so the
+   * whole matrix can be sent to the display with one transfer.
+   * 
+   * @tparam T The type of the elements.
+   * @tparam Columns The number of elements in a row.
+   * @tparam Rows The number of rows.
+   */
+  template<typename T, size_t Columns, size_t Rows>
+  class MatrixView
+  {
+    public:
+      /**
+       * @brief One row of the matrix.
+       * 
+       */
+      class Row
+      {
+        public:
+          constexpr explicit Row(T* data) : data_{data} {}
+
+          constexpr T& operator[](const size_t column) const { return data_[column]; }
+          constexpr T* data() const { return data_; }
+          constexpr T* begin() const { return data_; }
+          constexpr T* end() const { return data_ + Columns; }
+          static constexpr size_t size() { return Columns; }
+        private:
+          T* data_;
+      };
+
+      /**
+       * @brief Construct a new Matrix View object.
+       * 
+       * @param data Pointer to Rows * Columns elements, or nullptr.
+       */
+      constexpr MatrixView(T* data = nullptr) : data_{data} {}
+
+      constexpr Row operator[](const size_t row) const { return Row{data_ + row * Columns}; }
+
+      /**
+       * @brief Get the pointer to the first element of the first row.
+       */
+      constexpr T* data() const { return data_; }
+
+      static constexpr size_t size() { return Rows; }
+    private:
+      T* data_;
+  };
+}
+
+#endif //EMBEDDED_GFX_MATRIX_VIEW_HPP
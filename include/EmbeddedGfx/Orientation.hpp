@@ -0,0 +1,106 @@
+#ifndef EMBEDDED_GFX_ORIENTATION_HPP
+#define EMBEDDED_GFX_ORIENTATION_HPP
+
+#include <cstddef>
+#include <utility>
+
+namespace EmbeddedGfx
+{
+  /**
+   * Clockwise rotation of the canvas on the display.
+   * 
+   */
+  enum class Rotation
+  {
+    Rotate0,
+    Rotate90,
+    Rotate180,
+    Rotate270
+  };
+
+  /**
+   * @brief Policy mapping the coordinates of the canvas to the
+   * native coordinates of the display, resolved at compile time.
+   * 
+   * The canvas is first mirrored horizontally, if requested, and then
+   * rotated clockwise. With Rotate90 the top-left corner of the canvas
+   * ends up in the top-right corner of the display, so horizontal spans
+   * of the canvas become columns of the display and vice versa.
+   * 
+   * @tparam Rotate The clockwise rotation of the canvas.
+   * @tparam Mirror Mirror the canvas horizontally before the rotation.
+   */
+  template<Rotation Rotate = Rotation::Rotate0, bool Mirror = false>
+  struct Orientation
+  {
+    static constexpr Rotation rotation = Rotate;
+    static constexpr bool mirrored = Mirror;
+    static constexpr bool swapsAxes = (Rotate == Rotation::Rotate90) || (Rotate == Rotation::Rotate270);
+    static constexpr bool isIdentity = (Rotate == Rotation::Rotate0) && !Mirror;
+
+    /**
+     * @brief Map point of the canvas to the display.
+     * 
+     * @tparam Width The width of the canvas in pixels.
+     * @tparam Height The height of the canvas in pixels.
+     * @param x The x-coordinate, replaced by the native one.
+     * @param y The y-coordinate, replaced by the native one.
+     */
+    template<size_t Width, size_t Height, typename T>
+    static constexpr void mapPoint(T& x, T& y)
+    {
+      constexpr T lastX = static_cast<T>(Width) - 1;
+      constexpr T lastY = static_cast<T>(Height) - 1;
+      if constexpr(Mirror)
+      {
+        x = lastX - x;
+      }
+      if constexpr(Rotate == Rotation::Rotate90)
+      {
+        const T column = lastY - y;
+        y = x;
+        x = column;
+      }
+      else if constexpr(Rotate == Rotation::Rotate180)
+      {
+        x = lastX - x;
+        y = lastY - y;
+      }
+      else if constexpr(Rotate == Rotation::Rotate270)
+      {
+        const T row = lastX - x;
+        x = y;
+        y = row;
+      }
+    }
+
+    /**
+     * @brief Map rectangular area of the canvas to the display.
+     * The mapped area is again a rectangle, only the corners
+     * can swap their roles.
+     * 
+     * @tparam Width The width of the canvas in pixels.
+     * @tparam Height The height of the canvas in pixels.
+     * @param x0 The x-coordinate of the top-left corner, inclusive.
+     * @param y0 The y-coordinate of the top-left corner, inclusive.
+     * @param x1 The x-coordinate of the bottom-right corner, exclusive.
+     * @param y1 The y-coordinate of the bottom-right corner, exclusive.
+     */
+    template<size_t Width, size_t Height>
+    static constexpr void mapArea(int& x0, int& y0, int& x1, int& y1)
+    {
+      if constexpr(!isIdentity)
+      {
+        int lastX = x1 - 1, lastY = y1 - 1;
+        mapPoint<Width, Height>(x0, y0);
+        mapPoint<Width, Height>(lastX, lastY);
+        if(lastX < x0) std::swap(lastX, x0);
+        if(lastY < y0) std::swap(lastY, y0);
+        x1 = lastX + 1;
+        y1 = lastY + 1;
+      }
+    }
+  };
+}
+
+#endif //EMBEDDED_GFX_ORIENTATION_HPP
@@ -0,0 +1,81 @@
+#ifndef EMBEDDED_GFX_PALETTE_HPP
+#define EMBEDDED_GFX_PALETTE_HPP
+
+#include <array>
+#include <cstddef>
+
+#include "Colors.hpp"
+
+namespace EmbeddedGfx
+{
+  /**
+   * @brief Class representing lookup table which maps palette
+   * indices to the native pixel values of the display.
+   * 
+   * The colors are encoded once, when the palette is created or
+   * changed, so expanding the indices costs one table lookup
+   * per pixel.
+   * 
+   * @tparam ColorType The color representation type of the display.
+   * @tparam Size The number of colors in the palette.
+   */
+  template<typename ColorType, size_t Size>
+  class Palette
+  {
+    public:
+      using ColorT = ColorType;
+      using PixelT = typename ColorT::Type;
+
+      /**
+       * @brief Construct a new Palette object.
+       * 
+       * @param colors The colors of the palette, ordered by index.
+       */
+      constexpr Palette(const std::array<Color, Size>& colors) : lut_{}
+      {
+        for(size_t i = 0; i < Size; ++i)
+        {
+          lut_[i] = ColorT{colors[i]}.getValue();
+        }
+      }
+
+      /**
+       * @brief Change individual color of the palette.
+       * 
+       * @param index The index of the color.
+       * @param color The new color.
+       * @return true The color was changed.
+       * @return false The index is outside of the palette.
+       */
+      constexpr bool setColor(const size_t index, const Color& color)
+      {
+        if(index >= Size) return false;
+        lut_[index] = ColorT{color}.getValue();
+        return true;
+      }
+
+      /**
+       * @brief Get the pixel value of the display for the index.
+       * 
+       * @param index The index of the color, less than size(). The canvases
+       * check at compile time that the palette covers all their values.
+       * @return PixelT The encoded color.
+       */
+      constexpr PixelT operator[](const size_t index) const
+      {
+        return lut_[index];
+      }
+
+      /**
+       * @brief Get the number of colors in the palette.
+       */
+      static constexpr size_t size()
+      {
+        return Size;
+      }
+    private:
+      std::array<PixelT, Size> lut_;
+  };
+}
+
+#endif //EMBEDDED_GFX_PALETTE_HPP
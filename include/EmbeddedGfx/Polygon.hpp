@@ -5,7 +5,6 @@
 #include <array>
 #include <cstdint>
 #include <cstddef>
-#include <utility>
 
 #include "Shape.hpp"
 #include "Vector2D.hpp"
@@ -14,54 +13,55 @@
 namespace EmbeddedGfx
 {
   /**
-   * @brief Class representing convex polygon shape.
+   * Rules for deciding which parts of the polygon
+   * are inside when the polygon intersects itself.
+   * 
+   */
+  enum class FillRule
+  {
+    EvenOdd,
+    NonZero
+  };
+
+  /**
+   * @brief Class representing polygon shape. The polygon
+   * can be concave or self-intersecting.
+   * 
+   * The edge table used for filling is built and sorted in the
+   * constexpr constructor, so polygons of static layouts can be
+   * declared constexpr and need no computation before drawing.
    * 
    * @tparam Sides The number of sides for the polygon.
    * @tparam CanvasT The type of the canvas.
+   * @tparam CoordinateT The type of the coordinates, for example float,
+   * int or fixed-point type.
    */
-  template <uint8_t Sides, typename CanvasT>
+  template <uint8_t Sides, typename CanvasT, typename CoordinateT = float>
   class Polygon : public Shape<CanvasT>
   {
     public:
+      using PointT = Vector2D<CoordinateT>;
+
       /**
        * @brief Construct a new Polygon object
        * 
        * @param points The coordinates of the points
-       * for the polygon.
+       * for the polygon, in drawing order.
        */
-      Polygon(const std::array<Vector2Df, Sides>& points)
+      constexpr Polygon(const std::array<PointT, Sides>& points)
         : points_{points}
       {
-        // calculate the center of mass point
-        Vector2Df massCenter{};
-        for(const auto& point: points_) massCenter += point;
-        massCenter /= Sides;
-        // shift the center to the center of mass and 
-        // sort the points based on polar coordinates
-        using PolarCoordinates = std::pair<float, float>;  //< first is angle, second is abs
-        using HelperPair = std::pair<Vector2Df, PolarCoordinates>;
-        std::array<HelperPair, Sides> pointsPolarCoordinates{};
-        std::transform(points_.cbegin(), points_.cend(), pointsPolarCoordinates.begin()
-                      , [&massCenter](const Vector2Df& point) -> HelperPair { 
-                          return {
-                                point
-                              , {
-                                  (point - massCenter).angle()
-                                , (point - massCenter).abs()
-                                }
-                          };
-                        });
-        std::sort(pointsPolarCoordinates.begin(), pointsPolarCoordinates.end()
-                , [](const auto& v1, const auto& v2) {
-                    static constexpr float eps = 1e-7f;
-                    return (v1.second.first < v2.second.first)
-                        || ((std::abs(v1.second.first - v2.second.first) < eps)
-                          && (v1.second.second < v2.second.second));
-                  });
-        for(size_t iPoint = 0; iPoint < Sides; ++iPoint)
-        {
-          points_[iPoint] = pointsPolarCoordinates[iPoint].first;
-        }
+        buildEdges();
+      }
+
+      /**
+       * @brief Set the rule used for filling self-intersecting polygons.
+       * 
+       * @param rule The fill rule.
+       */
+      constexpr void setFillRule(const FillRule rule)
+      {
+        fillRule_ = rule;
       }
       
       /**
@@ -71,91 +71,195 @@ namespace EmbeddedGfx
        */
       void draw(CanvasT& canvas) const override
       {
+        if(!getBounds().intersects(canvas.getClip())) return;
         if(this->fillColor_)
         {
-          // scanline fill algorithm
-          ///@todo special cases
-          // 1. find ymin and ymax
-          const auto [yminFloat, ymaxFloat] = std::minmax_element(points_.cbegin(), points_.cend()
-                                              , [](const Vector2Df& a, const Vector2Df& b) {
-                                                      return a.y < b.y;
-                                                  });
-          const size_t ymin = static_cast<size_t>(std::roundf(yminFloat->y));
-          const size_t ymax = static_cast<size_t>(std::roundf(ymaxFloat->y));
-          // 2. find line equations for sides of the polygon
-          std::array<std::pair<std::optional<float>, float>, Sides> sidesEqs{};  //< first element is k, second is n
-          for(size_t i = 0; i < points_.size(); ++i)
+          drawFill(canvas);
+        }
+        if(this->outlineColor_)
+        {
+          for(size_t iPoint = 0; iPoint < Sides - 1; ++iPoint)
           {
-            const size_t j = (i == (points_.size() - 1)) ? 0 : i + 1;
-            static constexpr float eps = 1e-7f;
-            // check if line is vertical
-            if(std::abs(points_[j].x - points_[i].x) < eps)
-            {
-              sidesEqs[i].first = std::nullopt;
-              sidesEqs[i].second = points_[i].x;
-            }
-            else
-            {
-              sidesEqs[i].first = (points_[j].y - points_[i].y) / (points_[j].x - points_[i].x);
-              sidesEqs[i].second = points_[i].y - *(sidesEqs[i]).first * points_[i].x;
-            }
+            Line<CanvasT, CoordinateT>::drawLine(canvas, points_[iPoint], points_[iPoint + 1], *(this->outlineColor_));
           }
-          // 3. draw scanlines and find intersections with polygon sides
-          for(size_t y = ymin; y <= ymax; ++y)
+          Line<CanvasT, CoordinateT>::drawLine(canvas, points_[0], points_[Sides - 1], *(this->outlineColor_));
+        }
+      }
+
+      /**
+       * @brief Get the smallest rectangle containing all the pixels of the polygon.
+       * 
+       * @return Rect The bounding box.
+       */
+      Rect getBounds() const override
+      {
+        int x0 = roundCoordinate(points_[0].x), x1 = x0;
+        int y0 = roundCoordinate(points_[0].y), y1 = y0;
+        for(size_t i = 1; i < Sides; ++i)
+        {
+          const int x = roundCoordinate(points_[i].x);
+          const int y = roundCoordinate(points_[i].y);
+          x0 = std::min(x0, x);
+          x1 = std::max(x1, x);
+          y0 = std::min(y0, y);
+          y1 = std::max(y1, y);
+        }
+        // the fill stays between the rounded extremes of the outline
+        return {x0, y0, x1 + 1, y1 + 1};
+      }
+    private:
+      /// Fixed-point format of the edge coordinates, 16.16.
+      static constexpr int FractionBits = 16;
+      static constexpr int32_t One = int32_t{1} << FractionBits;
+
+      /**
+       * @brief Polygon edge prepared for scanline stepping.
+       * 
+       */
+      struct Edge
+      {
+        int yStart;      //< first row crossed by the edge
+        int yEnd;        //< row after the last one crossed by the edge
+        int64_t x;       //< x-coordinate at the current row
+        int64_t dxdy;    //< x increment per row, 64-bit for nearly horizontal edges
+        int8_t winding;  //< +1 for downward edge, -1 for upward edge
+      };
+
+      /**
+       * @brief Index of the first pixel that is not left of
+       * (or above) the fixed-point coordinate.
+       */
+      static constexpr int firstPixel(const int64_t value)
+      {
+        return static_cast<int>((value + One - 1) >> FractionBits);
+      }
+
+      /**
+       * @brief Build the edge table, skipping horizontal edges, and
+       * sort it by the first row crossed by the edges.
+       * 
+       */
+      constexpr void buildEdges()
+      {
+        for(size_t i = 0; i < Sides; ++i)
+        {
+          const auto& p0 = points_[i];
+          const auto& p1 = points_[(i + 1 == Sides) ? 0 : i + 1];
+          int32_t x0 = coordinateToRaw<FractionBits>(p0.x), y0 = coordinateToRaw<FractionBits>(p0.y);
+          int32_t x1 = coordinateToRaw<FractionBits>(p1.x), y1 = coordinateToRaw<FractionBits>(p1.y);
+          int8_t winding = 1;
+          if(y0 > y1)
           {
-            static constexpr size_t maxIntersections = 10;
-            std::array<size_t, maxIntersections> xmArray{};
-            size_t iIntersection = 0;  //< index for xmArray
-            for(size_t i = 0; i < sidesEqs.size(); ++i)
+            // std::swap is not constexpr before C++20
+            const int32_t x = x0, y = y0;
+            x0 = x1;
+            y0 = y1;
+            x1 = x;
+            y1 = y;
+            winding = -1;
+          }
+          const int yStart = firstPixel(y0);
+          const int yEnd = firstPixel(y1);
+          if(yStart >= yEnd) continue;
+          Edge& edge = edges_[edgeCount_++];
+          edge.yStart = yStart;
+          edge.yEnd = yEnd;
+          edge.winding = winding;
+          // the slope of nearly horizontal edges with fractional endpoints
+          // doesn't fit in 32 bits, the products below stay within 64 bits
+          // because the edge crosses at most (y1 - y0) / One + 1 rows
+          const int64_t dx = static_cast<int64_t>(x1) - x0;
+          const int64_t dy = static_cast<int64_t>(y1) - y0;
+          edge.dxdy = (dx * One) / dy;
+          const int64_t yOffset = static_cast<int64_t>(yStart) * One - y0;
+          edge.x = x0 + (dx * yOffset) / dy;
+          if(yEnd > yEnd_) yEnd_ = yEnd;
+        }
+        for(size_t i = 1; i < edgeCount_; ++i)
+        {
+          const Edge edge = edges_[i];
+          size_t j = i;
+          for(; j > 0 && edges_[j - 1].yStart > edge.yStart; --j) edges_[j] = edges_[j - 1];
+          edges_[j] = edge;
+        }
+      }
+
+      /**
+       * @brief Fill the polygon with active edge table scanline algorithm.
+       * 
+       * Pixel (x, y) is filled when the point (x, y) is inside the polygon,
+       * which keeps the fill aligned with the outline lines. The
+       * edges are sorted by the first row they cross and are stepped
+       * incrementally while they are active, so every row costs only
+       * fixed-point additions for the active edges.
+       * 
+       * @param canvas Reference to the canvas.
+       */
+      void drawFill(CanvasT& canvas) const
+      {
+        if(edgeCount_ == 0) return;
+
+        // 1. walk the rows that are inside the clip area
+        const Rect& clip = canvas.getClip();
+        const int yEnd = std::min(yEnd_, clip.y1);
+        std::array<Edge, Sides> active{};
+        size_t activeCount = 0;
+        size_t nextEdge = 0;
+        for(int y = std::max(edges_[0].yStart, clip.y0); y < yEnd; ++y)
+        {
+          // 2. drop the finished edges and step the remaining ones
+          size_t kept = 0;
+          for(size_t i = 0; i < activeCount; ++i)
+          {
+            if(active[i].yEnd > y)
             {
-              // calculate xm
-              float xm{};
-              // check if line is vertical
-              if(sidesEqs[i].first)
-              {
-                xm = (y - sidesEqs[i].second) / *(sidesEqs[i]).first;
-              }
-              else
-              {
-                xm = sidesEqs[i].second;
-              }
-              // check if xm is in bounds
-              // find x bounds
-              const auto [x1, x2] = std::minmax(points_[i].x, ((i == sidesEqs.size() - 1) ? points_[0].x : points_[i + 1].x));
-              if(xm >= x1 && xm <= x2)
-              {
-                xmArray[iIntersection++] = static_cast<size_t>(std::roundf(xm));
-              }
+              active[kept] = active[i];
+              active[kept].x += active[kept].dxdy;
+              ++kept;
             }
-            // 4. sort xm array
-            std::sort(xmArray.begin(), xmArray.begin() + iIntersection);
-            // 5. fill the cells between two consecutive xms
-            if(iIntersection > 1)
+          }
+          activeCount = kept;
+          // 3. activate the edges starting at this row
+          while(nextEdge < edgeCount_ && edges_[nextEdge].yStart <= y)
+          {
+            Edge edge = edges_[nextEdge++];
+            if(edge.yEnd <= y) continue;
+            edge.x += (y - edge.yStart) * edge.dxdy;
+            active[activeCount++] = edge;
+          }
+          // 4. keep the active edges sorted by x, they are nearly sorted already
+          for(size_t i = 1; i < activeCount; ++i)
+          {
+            const Edge edge = active[i];
+            size_t j = i;
+            for(; j > 0 && active[j - 1].x > edge.x; --j) active[j] = active[j - 1];
+            active[j] = edge;
+          }
+          // 5. fill the spans between the edges according to the fill rule
+          int winding = 0;
+          for(size_t i = 0; i + 1 < activeCount; ++i)
+          {
+            winding += (fillRule_ == FillRule::EvenOdd) ? 1 : active[i].winding;
+            const bool inside = (fillRule_ == FillRule::EvenOdd) ? (winding & 1) : (winding != 0);
+            if(inside)
             {
-              for(size_t i = 0; i < iIntersection - 1; i += 2)
+              const int xStart = firstPixel(active[i].x);
+              const int xEnd = firstPixel(active[i + 1].x);
+              if(xEnd > xStart)
               {
-                for(size_t x = xmArray[i]; x <= xmArray[i + 1]; ++x)
-                {
-                  canvas.setPixel(x, y, *(this->fillColor_));
-                }
+                canvas.drawHSpanRaw(xStart, y, xEnd - xStart, *(this->fillColor_));
               }
             }
           }
         }
-        if(this->outlineColor_)
-        {
-          for(size_t iPoint = 0; iPoint < Sides - 1; ++iPoint)
-          {
-            Line<CanvasT> line{points_[iPoint], points_[iPoint + 1], *(this->outlineColor_)};
-            line.draw(canvas);
-          }
-          Line<CanvasT> line{points_[0], points_[Sides - 1], *(this->outlineColor_)};
-          line.draw(canvas);
-        }
       }
-      private:
-        std::array<Vector2Df, Sides> points_;
-    };
+
+      std::array<PointT, Sides> points_;
+      std::array<Edge, Sides> edges_{};
+      size_t edgeCount_ = 0;
+      int yEnd_ = 0;
+      FillRule fillRule_ = FillRule::NonZero;
+  };
 }
 
 
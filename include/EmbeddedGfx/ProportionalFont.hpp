@@ -0,0 +1,112 @@
+#ifndef EMBEDDED_GFX_PROPORTIONAL_FONT_HPP
+#define EMBEDDED_GFX_PROPORTIONAL_FONT_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "Font.hpp"
+
+namespace EmbeddedGfx
+{
+  /**
+   * @brief Position and metrics of one glyph in the bitmaps of a proportional font.
+   * 
+   */
+  struct GlyphEntry
+  {
+    /// The index of the first byte of the glyph in the bitmaps.
+    uint16_t offset;
+    /// The number of columns of the bitmap.
+    uint8_t width;
+    /// The offset of the bitmap from the pen position.
+    int8_t left;
+    /// The distance of the pen position of the next character.
+    uint8_t advance;
+  };
+
+  /**
+   * @brief Adjustment of the distance between two characters.
+   * 
+   */
+  struct KerningPair
+  {
+    uint8_t left;
+    uint8_t right;
+    int8_t adjust;
+  };
+
+  /**
+   * @brief Font with glyphs of different widths and any height, for
+   * example generated from BDF font by the font compiler in tools.
+   * 
+   * Only the columns that have some pixels are stored, so narrow
+   * characters take less memory than with fixed width fonts. The
+   * characters outside of the range of the font are drawn with the
+   * fallback glyph.
+   * 
+   * @tparam DataT The tables of the font, a type with static members:
+   * - height, the height of all the glyphs in pixels,
+   * - first and last, the range of the character codes,
+   * - fallback, the index of the glyph for the characters outside of the range,
+   * - bitmaps, std::array of the bitmaps of all the glyphs, in the layout of Glyph,
+   * - glyphs, std::array of GlyphEntry for every character of the range,
+   * - kerning, std::array of KerningPair sorted by the characters, can be empty.
+   */
+  template<typename DataT>
+  class ProportionalFont
+  {
+    static_assert(DataT::glyphs.size() == DataT::last - DataT::first + 1u, "Font must have glyph for every character of the range.");
+    static_assert(DataT::fallback < DataT::glyphs.size(), "Fallback glyph must be in the font.");
+    public:
+      static constexpr uint8_t height = DataT::height;
+
+      /**
+       * @brief Get the bitmap and the metrics of a character.
+       * 
+       * @param c The character.
+       * @return Glyph The glyph pointing to the bitmap in the tables.
+       */
+      static constexpr Glyph getGlyph(const char c)
+      {
+        const uint8_t code = static_cast<uint8_t>(c);
+        const GlyphEntry& entry = (code >= DataT::first && code <= DataT::last)
+                                ? DataT::glyphs[code - DataT::first]
+                                : DataT::glyphs[DataT::fallback];
+        return {DataT::bitmaps.data() + entry.offset, entry.width, entry.left, entry.advance};
+      }
+
+      /**
+       * @brief Get the adjustment of the distance between two characters.
+       * 
+       * @param left The first character.
+       * @param right The character following it.
+       * @return int The number of pixels added to the advance of the first character.
+       */
+      static constexpr int getKerning(const char left, const char right)
+      {
+        // binary search in the pairs sorted by the first and the second character
+        const uint16_t key = pairKey(static_cast<uint8_t>(left), static_cast<uint8_t>(right));
+        size_t low = 0;
+        size_t high = DataT::kerning.size();
+        while(low < high)
+        {
+          const size_t middle = (low + high) / 2;
+          const KerningPair& pair = DataT::kerning[middle];
+          const uint16_t middleKey = pairKey(pair.left, pair.right);
+          if(middleKey == key) return pair.adjust;
+          if(middleKey < key) low = middle + 1;
+          else high = middle;
+        }
+        return 0;
+      }
+
+    private:
+      static constexpr uint16_t pairKey(const uint8_t left, const uint8_t right)
+      {
+        return static_cast<uint16_t>((left << 8) | right);
+      }
+  };
+}
+
+#endif //EMBEDDED_GFX_PROPORTIONAL_FONT_HPP
@@ -0,0 +1,137 @@
+#ifndef EMBEDDED_GFX_RECT_HPP
+#define EMBEDDED_GFX_RECT_HPP
+
+#include <algorithm>
+#include <limits>
+
+namespace EmbeddedGfx
+{
+  /**
+   * @brief Axis-aligned rectangle in pixel coordinates.
+   * 
+   * The top-left corner is inclusive and the bottom-right
+   * corner is exclusive, so the rectangle covers
+   * (x1 - x0) x (y1 - y0) pixels.
+   */
+  struct Rect
+  {
+    int x0, y0;
+    int x1, y1;
+
+    constexpr Rect() : Rect{0, 0, 0, 0} { }
+
+    constexpr Rect(const int x0, const int y0, const int x1, const int y1)
+      : x0{x0}, y0{y0}, x1{x1}, y1{y1} { }
+
+    /**
+     * @brief Create rectangle from the top-left corner and the size.
+     * 
+     * @param x The x-coordinate of the top-left corner.
+     * @param y The y-coordinate of the top-left corner.
+     * @param w The width of the rectangle.
+     * @param h The height of the rectangle.
+     * @return Rect The rectangle.
+     */
+    static constexpr Rect fromSize(const int x, const int y, const int w, const int h)
+    {
+      return {x, y, x + w, y + h};
+    }
+
+    /**
+     * @brief Create rectangle covering all the representable coordinates,
+     * for objects whose extent is not known. Only the comparisons and
+     * intersected() are meaningful for it, not the size or the area.
+     */
+    static constexpr Rect unbounded()
+    {
+      return {std::numeric_limits<int>::min(), std::numeric_limits<int>::min()
+            , std::numeric_limits<int>::max(), std::numeric_limits<int>::max()};
+    }
+
+    constexpr int getWidth() const { return x1 - x0; }
+
+    constexpr int getHeight() const { return y1 - y0; }
+
+    /**
+     * @brief Check if the rectangle covers no pixels.
+     */
+    constexpr bool isEmpty() const
+    {
+      return (x0 >= x1) || (y0 >= y1);
+    }
+
+    /**
+     * @brief Compute the number of pixels in the rectangle.
+     */
+    constexpr long getArea() const
+    {
+      return isEmpty() ? 0 : static_cast<long>(getWidth()) * getHeight();
+    }
+
+    /**
+     * @brief Check if the pixel is inside the rectangle.
+     */
+    constexpr bool contains(const int x, const int y) const
+    {
+      return (x >= x0) && (x < x1) && (y >= y0) && (y < y1);
+    }
+
+    /**
+     * @brief Check if the rectangle is completely inside this one.
+     */
+    constexpr bool contains(const Rect& rect) const
+    {
+      return rect.isEmpty()
+          || ((rect.x0 >= x0) && (rect.x1 <= x1) && (rect.y0 >= y0) && (rect.y1 <= y1));
+    }
+
+    /**
+     * @brief Check if the two rectangles share at least one pixel.
+     */
+    constexpr bool intersects(const Rect& rect) const
+    {
+      return (x0 < rect.x1) && (rect.x0 < x1) && (y0 < rect.y1) && (rect.y0 < y1)
+          && !isEmpty() && !rect.isEmpty();
+    }
+
+    /**
+     * @brief Check if the two rectangles overlap or share an edge.
+     */
+    constexpr bool touches(const Rect& rect) const
+    {
+      return (x0 <= rect.x1) && (rect.x0 <= x1) && (y0 <= rect.y1) && (rect.y0 <= y1);
+    }
+
+    /**
+     * @brief Compute the smallest rectangle containing both rectangles.
+     */
+    constexpr Rect united(const Rect& rect) const
+    {
+      if(isEmpty()) return rect;
+      if(rect.isEmpty()) return *this;
+      return {std::min(x0, rect.x0), std::min(y0, rect.y0)
+            , std::max(x1, rect.x1), std::max(y1, rect.y1)};
+    }
+
+    /**
+     * @brief Compute the area shared by both rectangles.
+     */
+    constexpr Rect intersected(const Rect& rect) const
+    {
+      return {std::max(x0, rect.x0), std::max(y0, rect.y0)
+            , std::min(x1, rect.x1), std::min(y1, rect.y1)};
+    }
+
+    constexpr bool operator==(const Rect& rect) const
+    {
+      return (x0 == rect.x0) && (y0 == rect.y0) && (x1 == rect.x1) && (y1 == rect.y1);
+    }
+
+    constexpr bool operator!=(const Rect& rect) const
+    {
+      return !(*this == rect);
+    }
+  };
+}
+
+#endif // EMBEDDED_GFX_RECT_HPP
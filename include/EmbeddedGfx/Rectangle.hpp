@@ -1,19 +1,26 @@
 #ifndef EMBEDDED_GFX_RECTANGLE_HPP
 #define EMBEDDED_GFX_RECTANGLE_HPP
 
-#include "Polygon.hpp"
+#include <utility>
+
+#include "Shape.hpp"
+#include "Vector2D.hpp"
 
 namespace EmbeddedGfx
 {
   /**
-   * @brief Class representing rectangle shape.
+   * @brief Class representing axis-aligned rectangle shape.
    * 
    * @tparam CanvasT The type of the canvas.
+   * @tparam CoordinateT The type of the coordinates, for example float,
+   * int or fixed-point type.
    */
-  template <typename CanvasT>
-  class Rectangle : public Polygon<4, CanvasT>
+  template <typename CanvasT, typename CoordinateT = float>
+  class Rectangle final : public Shape<CanvasT>
   {
     public:
+      using PointT = Vector2D<CoordinateT>;
+
       /**
        * @brief Construct a new Rectangle object.
        * 
@@ -22,8 +29,9 @@ namespace EmbeddedGfx
        * @param w The width of the rectangle.
        * @param h The height of the rectangle.
        */
-      Rectangle(float x, float y, float w, float h)
-        : Polygon<4, CanvasT>{{{{x, y}, {x + w, y}, {x + w, y + h}, {x, y + h}}}}
+      constexpr Rectangle(CoordinateT x, CoordinateT y, CoordinateT w, CoordinateT h)
+        : topLeftPoint_{x, y}
+        , size_{w, h}
       {
       }
 
@@ -34,13 +42,66 @@ namespace EmbeddedGfx
        * @param w The width of the rectangle.
        * @param h The height of the rectangle.
        */
-      Rectangle(const Vector2Df& topLeftPoint, float w, float h)
-        : Polygon<4, CanvasT>{{{topLeftPoint, topLeftPoint + Vector2Df{w, 0}
-                              , topLeftPoint + Vector2Df{w, h}, topLeftPoint + Vector2Df{0, h}}}}
+      constexpr Rectangle(const PointT& topLeftPoint, CoordinateT w, CoordinateT h)
+        : topLeftPoint_{topLeftPoint}
+        , size_{w, h}
+      {
+      }
+
+      /**
+       * @brief Draw the rectangle on the canvas.
+       * 
+       * The fill covers the pixels from the top-left point up to, but not
+       * including, the bottom-right point, the same as a polygon with the
+       * same corners. The outline passes through all four corners.
+       * 
+       * @param canvas Reference to the canvas.
+       */
+      void draw(CanvasT& canvas) const override
+      {
+        if(!getBounds().intersects(canvas.getClip())) return;
+        int x0 = roundCoordinate(topLeftPoint_.x);
+        int y0 = roundCoordinate(topLeftPoint_.y);
+        int x1 = roundCoordinate(topLeftPoint_.x + size_.x);
+        int y1 = roundCoordinate(topLeftPoint_.y + size_.y);
+        if(x0 > x1) std::swap(x0, x1);
+        if(y0 > y1) std::swap(y0, y1);
+        if(this->fillColor_)
+        {
+          canvas.fillRectRaw(x0, y0, x1 - x0, y1 - y0, *(this->fillColor_));
+        }
+        if(this->outlineColor_)
+        {
+          const auto& color = *(this->outlineColor_);
+          canvas.drawHSpanRaw(x0, y0, x1 - x0 + 1, color);
+          if(y1 == y0) return;
+          canvas.drawHSpanRaw(x0, y1, x1 - x0 + 1, color);
+          canvas.drawVSpanRaw(x0, y0 + 1, y1 - y0 - 1, color);
+          canvas.drawVSpanRaw(x1, y0 + 1, y1 - y0 - 1, color);
+        }
+      }
+
+      /**
+       * @brief Get the smallest rectangle containing all the pixels of the rectangle.
+       * 
+       * @return Rect The bounding box.
+       */
+      Rect getBounds() const override
       {
+        int x0 = roundCoordinate(topLeftPoint_.x);
+        int y0 = roundCoordinate(topLeftPoint_.y);
+        int x1 = roundCoordinate(topLeftPoint_.x + size_.x);
+        int y1 = roundCoordinate(topLeftPoint_.y + size_.y);
+        if(x0 > x1) std::swap(x0, x1);
+        if(y0 > y1) std::swap(y0, y1);
+        // the outline includes the bottom-right corner
+        return {x0, y0, x1 + 1, y1 + 1};
       }
+    private:
+      PointT topLeftPoint_;
+      PointT size_;
   };
 }
 
 
-#endif // EMBEDDED_GFX_RECTANGLE_HPP
\ No newline at end of file
+#endif // EMBEDDED_GFX_RECTANGLE_HPP
@@ -0,0 +1,229 @@
+#ifndef EMBEDDED_GFX_RETAINED_SCENE_HPP
+#define EMBEDDED_GFX_RETAINED_SCENE_HPP
+
+#include <array>
+#include <cstddef>
+
+#include "DirtyRegion.hpp"
+#include "Drawable.hpp"
+#include "Rect.hpp"
+
+namespace EmbeddedGfx
+{
+  /**
+   * @brief Retained list of drawables which redraws only the
+   * damaged parts of the canvas.
+   * 
+   * The drawables are kept in z-order, the first one at the bottom,
+   * together with their bounding boxes from the last render. Moving
+   * or resizing an object is detected by comparing its bounding box,
+   * other changes must be reported with invalidate(). The damage
+   * is the union of the old and the new bounding boxes. Every damaged
+   * area is cleared with the background, and only the objects that
+   * intersect it are redrawn, clipped to the area.
+   * 
+   * @tparam CanvasT The type of the canvas.
+   * @tparam Capacity The maximum number of drawables.
+   * @tparam MaxDamageRects The maximum number of separate damaged areas.
+   */
+  template<typename CanvasT, size_t Capacity, size_t MaxDamageRects = 4>
+  class RetainedScene
+  {
+    public:
+      using ColorT = typename CanvasT::ColorT;
+      using PixelT = typename CanvasT::PixelT;
+      using DrawableT = Drawable<CanvasT>;
+      using DamageT = DirtyRegion<MaxDamageRects>;
+
+      /**
+       * @brief Construct a new Retained Scene object.
+       * The whole canvas is damaged, so the first render draws everything.
+       * 
+       * @param canvas Reference to the canvas the scene is rendered on.
+       * @param background The color of the canvas behind the drawables.
+       */
+      RetainedScene(CanvasT& canvas, const ColorT& background = {})
+        : canvas_{canvas}
+        , background_{background.getValue()}
+      {
+        invalidateAll();
+      }
+
+      /**
+       * @brief Add drawable on top of the scene.
+       * The drawable must outlive the scene.
+       * 
+       * @param drawable Reference to drawable object.
+       * @return true The drawable was added.
+       * @return false There is no space for more drawables.
+       */
+      bool add(const DrawableT& drawable)
+      {
+        if(size_ == Capacity) return false;
+        const Rect bounds = getClippedBounds(drawable);
+        entries_[size_++] = {&drawable, bounds};
+        damage_.add(bounds);
+        return true;
+      }
+
+      /**
+       * @brief Remove drawable from the scene.
+       * 
+       * @param drawable Reference to drawable object.
+       * @return true The drawable was removed.
+       * @return false The drawable is not in the scene.
+       */
+      bool remove(const DrawableT& drawable)
+      {
+        const size_t index = find(drawable);
+        if(index == size_) return false;
+        damage_.add(entries_[index].bounds);
+        for(size_t i = index + 1; i < size_; ++i)
+        {
+          entries_[i - 1] = entries_[i];
+        }
+        --size_;
+        return true;
+      }
+
+      /**
+       * @brief Report that the drawable changed, for example its color
+       * or its text. Changes of the bounding box are detected without it.
+       * 
+       * @param drawable Reference to drawable object.
+       */
+      void invalidate(const DrawableT& drawable)
+      {
+        const size_t index = find(drawable);
+        if(index == size_) return;
+        Entry& entry = entries_[index];
+        damage_.add(entry.bounds);
+        entry.bounds = getClippedBounds(drawable);
+        damage_.add(entry.bounds);
+      }
+
+      /**
+       * @brief Damage the whole canvas.
+       * 
+       */
+      void invalidateAll()
+      {
+        damage_.add(getCanvasBounds());
+      }
+
+      /**
+       * @brief Set the color of the canvas behind the drawables.
+       * 
+       * @param color The background color.
+       */
+      void setBackground(const ColorT& color)
+      {
+        background_ = color.getValue();
+        invalidateAll();
+      }
+
+      /**
+       * @brief Get the areas which will be redrawn by the next render.
+       * 
+       * @return const DamageT& The damaged areas.
+       */
+      const DamageT& getDamage() const
+      {
+        return damage_;
+      }
+
+      /**
+       * @brief Find the objects whose bounding box changed and
+       * damage their old and new bounds. Called by render().
+       * 
+       */
+      void update()
+      {
+        for(size_t i = 0; i < size_; ++i)
+        {
+          Entry& entry = entries_[i];
+          const Rect bounds = getClippedBounds(*entry.drawable);
+          if(bounds != entry.bounds)
+          {
+            damage_.add(entry.bounds);
+            damage_.add(bounds);
+            entry.bounds = bounds;
+          }
+        }
+      }
+
+      /**
+       * @brief Redraw the damaged areas of the canvas, within the
+       * clip area which is active on the canvas.
+       * 
+       * @return true Something was redrawn.
+       * @return false Nothing was damaged, or the clip stack of the
+       * canvas is full and the damage is kept for the next render.
+       */
+      bool render()
+      {
+        update();
+        if(damage_.isEmpty()) return false;
+        // the depth is checked before anything is drawn, every area
+        // is popped before the next one, so one free level is enough
+        if(canvas_.getClipDepth() == CanvasT::MaxClipDepth) return false;
+        // every damaged area is cleared and the objects in it are redrawn
+        for(const Rect& area: damage_)
+        {
+          canvas_.pushClip(area);
+          canvas_.fillRectRaw(area.x0, area.y0, area.getWidth(), area.getHeight(), background_);
+          for(size_t i = 0; i < size_; ++i)
+          {
+            if(entries_[i].bounds.intersects(area))
+            {
+              canvas_.draw(*entries_[i].drawable);
+            }
+          }
+          canvas_.popClip();
+        }
+        damage_.clear();
+        return true;
+      }
+
+    private:
+      /**
+       * @brief Drawable with its bounding box from the last render.
+       * 
+       */
+      struct Entry
+      {
+        const DrawableT* drawable;
+        Rect bounds;
+      };
+
+      Rect getCanvasBounds() const
+      {
+        return {0, 0, static_cast<int>(canvas_.getWidth()), static_cast<int>(canvas_.getHeight())};
+      }
+
+      /**
+       * @brief Get the bounding box of the drawable limited to the
+       * canvas, so that unbounded drawables don't overflow the area.
+       */
+      Rect getClippedBounds(const DrawableT& drawable) const
+      {
+        const Rect bounds = drawable.getBounds().intersected(getCanvasBounds());
+        return bounds.isEmpty() ? Rect{} : bounds;
+      }
+
+      size_t find(const DrawableT& drawable) const
+      {
+        size_t index = 0;
+        while(index < size_ && entries_[index].drawable != &drawable) ++index;
+        return index;
+      }
+
+      CanvasT& canvas_;
+      PixelT background_;
+      std::array<Entry, Capacity> entries_{};
+      size_t size_ = 0;
+      DamageT damage_;
+  };
+}
+
+#endif //EMBEDDED_GFX_RETAINED_SCENE_HPP
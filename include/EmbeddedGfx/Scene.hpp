@@ -0,0 +1,176 @@
+#ifndef EMBEDDED_GFX_SCENE_HPP
+#define EMBEDDED_GFX_SCENE_HPP
+
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <utility>
+#include <variant>
+
+#include "Drawable.hpp"
+
+namespace EmbeddedGfx
+{
+  /**
+   * @brief Scene of fixed set of drawables, held by value.
+   * 
+   * The types of all the objects are known at compile time, so
+   * they are drawn without virtual calls and the drawing of every
+   * object can be inlined into the canvas. The scene itself can be
+   * drawn with Canvas::draw.
+   * 
+   * @tparam CanvasT The type of the canvas.
+   * @tparam DrawablesT The types of the drawables, in drawing order.
+   */
+  template<typename CanvasT, typename... DrawablesT>
+  class StaticScene
+  {
+    static_assert((IsDrawable<DrawablesT, CanvasT>::value && ...), "All scene objects must be drawable on the canvas.");
+    public:
+      /**
+       * @brief Construct a new Static Scene object.
+       * 
+       * @param drawables The drawables, copied into the scene.
+       */
+      constexpr StaticScene(const DrawablesT&... drawables)
+        : drawables_{drawables...}
+      {
+      }
+
+      /**
+       * @brief Get the drawable at the given position.
+       * 
+       * @tparam Index The position of the drawable in the scene.
+       */
+      template<size_t Index>
+      constexpr auto& get()
+      {
+        return std::get<Index>(drawables_);
+      }
+
+      template<size_t Index>
+      constexpr const auto& get() const
+      {
+        return std::get<Index>(drawables_);
+      }
+
+      /**
+       * @brief Draw all the drawables on the canvas.
+       * 
+       * @param canvas Reference to the canvas.
+       */
+      void draw(CanvasT& canvas) const
+      {
+        std::apply([&canvas](const auto&... drawables) {
+          (drawStatic(drawables, canvas), ...);
+        }, drawables_);
+      }
+
+    private:
+      std::tuple<DrawablesT...> drawables_;
+  };
+
+  /**
+   * @brief Scene of up to Capacity drawables of the given types,
+   * held by value in variants.
+   * 
+   * Unlike StaticScene, the objects can be added and removed at
+   * runtime. Every object is drawn through a switch on the index
+   * of its type, without virtual calls and without std::visit,
+   * which could throw.
+   * 
+   * @tparam CanvasT The type of the canvas.
+   * @tparam Capacity The maximum number of drawables.
+   * @tparam DrawablesT The types of the drawables which can be added.
+   */
+  template<typename CanvasT, size_t Capacity, typename... DrawablesT>
+  class VariantScene
+  {
+    static_assert((IsDrawable<DrawablesT, CanvasT>::value && ...), "All scene objects must be drawable on the canvas.");
+    public:
+      /// The empty state marks unused slots.
+      using ItemT = std::variant<std::monostate, DrawablesT...>;
+
+      /**
+       * @brief Add copy of the drawable on top of the scene.
+       * 
+       * @param drawable The drawable, of one of the scene types.
+       * @return true The drawable was added.
+       * @return false There is no space for more drawables.
+       */
+      template<typename T>
+      bool add(const T& drawable)
+      {
+        if(size_ == Capacity) return false;
+        items_[size_++] = drawable;
+        return true;
+      }
+
+      /**
+       * @brief Get the drawable at the given position.
+       * 
+       * @tparam T The type of the drawable.
+       * @param index The position of the drawable, in drawing order.
+       * @return T* Pointer to the drawable, nullptr if there is no
+       * drawable of type T at the position.
+       */
+      template<typename T>
+      T* get(const size_t index)
+      {
+        return (index < size_) ? std::get_if<T>(&items_[index]) : nullptr;
+      }
+
+      template<typename T>
+      const T* get(const size_t index) const
+      {
+        return (index < size_) ? std::get_if<T>(&items_[index]) : nullptr;
+      }
+
+      /**
+       * @brief Get the number of drawables in the scene.
+       */
+      size_t size() const
+      {
+        return size_;
+      }
+
+      /**
+       * @brief Remove all drawables.
+       * 
+       */
+      void clearDrawables()
+      {
+        for(size_t i = 0; i < size_; ++i)
+        {
+          items_[i] = std::monostate{};
+        }
+        size_ = 0;
+      }
+
+      /**
+       * @brief Draw all the drawables on the canvas.
+       * 
+       * @param canvas Reference to the canvas.
+       */
+      void draw(CanvasT& canvas) const
+      {
+        for(size_t i = 0; i < size_; ++i)
+        {
+          drawItem(items_[i], canvas, std::index_sequence_for<DrawablesT...>{});
+        }
+      }
+
+    private:
+      template<size_t... Indices>
+      static void drawItem(const ItemT& item, CanvasT& canvas, std::index_sequence<Indices...>)
+      {
+        // index 0 is the empty state
+        ((item.index() == Indices + 1 ? drawStatic(*std::get_if<Indices + 1>(&item), canvas) : void()), ...);
+      }
+
+      std::array<ItemT, Capacity> items_{};
+      size_t size_ = 0;
+  };
+}
+
+#endif //EMBEDDED_GFX_SCENE_HPP
@@ -10,6 +10,11 @@ namespace EmbeddedGfx
   /**
    * @brief Interface for shape objects.
    * 
+   * The colors are encoded for the canvas once, when they are
+   * set, so drawing writes the encoded values directly. The setters
+   * are constexpr, so shapes of static layouts can be fully built
+   * at compile time.
+   * 
    * @tparam CanvasT Type of the canvas.
    */
   template <typename CanvasT>
@@ -17,18 +22,25 @@ namespace EmbeddedGfx
   {
     public:
       using ColorT = typename CanvasT::ColorT;
+      using PixelT = typename CanvasT::PixelT;
     public:
-      void setOutlineColor(const std::optional<ColorT>& color = std::nullopt)
+      constexpr void setOutlineColor(const std::optional<ColorT>& color = std::nullopt)
       {
-        outlineColor_ = color;
+        outlineColor_ = encode(color);
       }
-      void setFillColor(const std::optional<ColorT>& color = std::nullopt)
+      constexpr void setFillColor(const std::optional<ColorT>& color = std::nullopt)
       {
-        fillColor_ = color;
+        fillColor_ = encode(color);
       }
     protected:
-      std::optional<ColorT> outlineColor_ = {};
-      std::optional<ColorT> fillColor_ = {};
+      static constexpr std::optional<PixelT> encode(const std::optional<ColorT>& color)
+      {
+        if(color) return color->getValue();
+        return std::nullopt;
+      }
+
+      std::optional<PixelT> outlineColor_ = {};
+      std::optional<PixelT> fillColor_ = {};
   };
 }
 
@@ -1,26 +1,36 @@
 #ifndef EMBEDDED_GFX_TEXT_HPP
 #define EMBEDDED_GFX_TEXT_HPP
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 
 #include "Drawable.hpp"
 #include "Font.hpp"
+#include "Vector2D.hpp"
 
 namespace EmbeddedGfx
 {
   /**
    * @brief Class representing text.
    * 
+   * The characters are placed by the advance of their glyphs and
+   * the kerning of the font, so fixed width fonts like Font<6,8>
+   * and proportional fonts are drawn the same way.
+   * 
    * @tparam BufferSize The number of characters the buffer can hold.
    * @tparam FontT The type of the font.
    * @tparam CanvasT The type of the canvas.
+   * @tparam CoordinateT The type of the coordinates, for example float,
+   * int or fixed-point type.
    */
-  template <uint8_t BufferSize, typename FontT, typename CanvasT>
-  class Text : public Drawable<CanvasT>
+  template <uint8_t BufferSize, typename FontT, typename CanvasT, typename CoordinateT = float>
+  class Text final : public Drawable<CanvasT>
   {
     public:
       using ColorT = typename CanvasT::ColorT;
+      using PixelT = typename CanvasT::PixelT;
+      using PointT = Vector2D<CoordinateT>;
     public:
       /**
        * @brief Construct a new Text object.
@@ -28,7 +38,7 @@ namespace EmbeddedGfx
        * @param text The text to be stored.
        * @param pos The coordinates of the top-left corner.
        */
-      Text(const char * const text, const Vector2Df& pos = {})
+      Text(const char * const text, const PointT& pos = {})
         : position_{pos}
       {
         setString(text);
@@ -36,7 +46,7 @@ namespace EmbeddedGfx
 
       void setColor(const ColorT& color)
       {
-        color_ = color;
+        color_ = color.getValue();
       }
 
       /**
@@ -46,28 +56,59 @@ namespace EmbeddedGfx
        */
       void draw(CanvasT& canvas) const override
       {
-        auto textLength = std::strlen(text_);
-        for(size_t iLetter = 0
-            ; (iLetter < textLength) 
-            && (iLetter < (canvas.getWidth() - static_cast<uint8_t>(position_.x))/FontT::width)
-            ; ++iLetter)
+        const Rect& clip = canvas.getClip();
+        if(!getBounds().intersects(clip)) return;
+        int pen = roundCoordinate(position_.x);
+        const int top = roundCoordinate(position_.y);
+        // only the pages of the glyphs which cross the clip area are drawn
+        const int firstPage = std::max(clip.y0 - top, 0) / 8;
+        const int lastPage = std::min(clip.y1 - top + 7, static_cast<int>(FontT::height) + 7) / 8;
+        for(const char* c = text_; *c; ++c)
         {
-          const auto pixels = FontT::getCharacter(text_[iLetter]);
-          for(size_t x = 0; x < FontT::width; ++x)
+          // the glyphs outside of the clip area are skipped
+          const Glyph glyph = FontT::getGlyph(*c);
+          const int glyphLeft = pen + glyph.left;
+          pen += glyph.advance + FontT::getKerning(c[0], c[1]);
+          if(glyphLeft >= clip.x1 || glyphLeft + glyph.width <= clip.x0) continue;
+          // every column of the glyph page is one byte, drawn at once
+          for(int page = firstPage; page < lastPage; ++page)
           {
-            for(size_t y = 0; y < FontT::height; ++y)
+            const uint8_t* columns = glyph.columns + page * glyph.width;
+            for(int x = 0; x < glyph.width; ++x)
             {
-              if(pixels[x] & (1 << y))
-              {
-                canvas.setPixel(x + static_cast<uint8_t>(position_.x) + iLetter * FontT::width
-                                , static_cast<uint8_t>(position_.y) + y
-                                , color_);
-              }
+              if(columns[x]) canvas.drawColumnRaw(glyphLeft + x, top + page * 8, columns[x], color_);
             }
           }
         }
       }
 
+      /**
+       * @brief Get the smallest rectangle containing all the pixels of the text.
+       * 
+       * @return Rect The bounding box.
+       */
+      Rect getBounds() const override
+      {
+        int pen = roundCoordinate(position_.x);
+        const int top = roundCoordinate(position_.y);
+        int x0 = pen;
+        int x1 = pen;
+        bool empty = true;
+        for(const char* c = text_; *c; ++c)
+        {
+          const Glyph glyph = FontT::getGlyph(*c);
+          if(glyph.width != 0)
+          {
+            const int glyphLeft = pen + glyph.left;
+            x0 = empty ? glyphLeft : std::min(x0, glyphLeft);
+            x1 = empty ? glyphLeft + glyph.width : std::max(x1, glyphLeft + glyph.width);
+            empty = false;
+          }
+          pen += glyph.advance + FontT::getKerning(c[0], c[1]);
+        }
+        return {x0, top, x1, top + static_cast<int>(FontT::height)};
+      }
+
       /**
        * @brief Set the text content.
        * 
@@ -84,15 +125,15 @@ namespace EmbeddedGfx
        * 
        * @param pos Coordinates of the top-left corner.
        */
-      void setPosition(const Vector2Df& pos)
+      void setPosition(const PointT& pos)
       {
         position_ = pos;
       }
 
     private:
       char text_[BufferSize];
-      Vector2Df position_;
-      ColorT color_;
+      PointT position_;
+      PixelT color_ = {};
   };
 }
 
@@ -10,18 +10,22 @@ namespace EmbeddedGfx
    * @brief Class representing triangle shape.
    * 
    * @tparam CanvasT The type of the canvas.
+   * @tparam CoordinateT The type of the coordinates, for example float,
+   * int or fixed-point type.
    */
-  template <typename CanvasT>
-  class Triangle : public Polygon<3, CanvasT>
+  template <typename CanvasT, typename CoordinateT = float>
+  class Triangle final : public Polygon<3, CanvasT, CoordinateT>
   {
     public:
+      using PointT = Vector2D<CoordinateT>;
+
       /**
        * @brief Construct a new Triangle object
        * 
        * @param points The points of the triangle.
        */
-      Triangle(const std::array<Vector2Df, 3>& points)
-        : Polygon<3, CanvasT>{points}
+      constexpr Triangle(const std::array<PointT, 3>& points)
+        : Polygon<3, CanvasT, CoordinateT>{points}
       {
       }
 
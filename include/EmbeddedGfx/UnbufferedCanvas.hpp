@@ -1,10 +1,35 @@
 #ifndef EMBEDDED_GFX_UNBUFFERED_CANVAS_HPP
 #define EMBEDDED_GFX_UNBUFFERED_CANVAS_HPP
 
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
 #include "Canvas.hpp"
+#include "Dither.hpp"
+#include "Orientation.hpp"
 
 namespace EmbeddedGfx
 {
+  /**
+   * @brief Check if the display supports address window streaming,
+   * i.e. it has methods setWindow(x0, y0, x1, y1),
+   * writePixels(const PixelT*, n) and fillPixels(value, n).
+   * 
+   * @tparam DisplayT The type for the display device.
+   * @tparam PixelT The type of the pixel value.
+   */
+  template <typename DisplayT, typename PixelT, typename = void>
+  struct HasAddressWindow : std::false_type {};
+
+  template <typename DisplayT, typename PixelT>
+  struct HasAddressWindow<DisplayT, PixelT, std::void_t<
+      decltype(std::declval<DisplayT&>().setWindow(size_t{}, size_t{}, size_t{}, size_t{}))
+    , decltype(std::declval<DisplayT&>().writePixels(std::declval<const PixelT*>(), size_t{}))
+    , decltype(std::declval<DisplayT&>().fillPixels(std::declval<PixelT>(), size_t{}))>>
+    : std::true_type {};
+
   /**
    * @brief Class represnting canvas with buffer in memory.
    * 
@@ -13,18 +38,39 @@ namespace EmbeddedGfx
    * @tparam Type The type of the canvas.
    * @tparam ColorType The color representation type.
    * @tparam DisplayT The type for the display device.
-   * @note DisplayT must have method setPixel(x, y, value).
+   * @tparam QueueSize The number of pixels that can be merged into one run,
+   * 0 disables the merging. Requires display with address window.
+   * @tparam OrientationT The rotation and mirroring of the canvas on the display.
+   * @note DisplayT must have method setPixel(x, y, value). If DisplayT also
+   * has methods setWindow(x0, y0, x1, y1), writePixels(values, n) and
+   * fillPixels(value, n), the spans and the filled areas are sent as one
+   * window followed by one burst of pixels. The window corners are inclusive
+   * and the pixels fill the window row by row.
+   * @note With QueueSize > 0, single pixels which continue the previous
+   * pixel in the same row or column are merged into one run and sent as one
+   * window when the run breaks, when the queue is full, before any fill and
+   * on flush(). Call flush() before the display contents are needed.
+   * @note The display always receives its native coordinates. The areas are
+   * mapped as a whole, so with rotation by 90 or 270 degrees the horizontal
+   * spans reach the display as columns.
+   * @note With Dithered colors the display receives 0 or 1 for every pixel,
+   * after the ordered dither pattern is applied.
    */
-  template<size_t Width, size_t Height, CanvasType Type, typename ColorType, typename DisplayT>
+  template<size_t Width, size_t Height, CanvasType Type, typename ColorType, typename DisplayT, size_t QueueSize = 0, typename OrientationT = Orientation<>>
   class UnbufferedCanvas
     : public Canvas<Width, Height, Type, ColorType
-                  , UnbufferedCanvas<Width, Height, Type, ColorType, DisplayT>>
+                  , UnbufferedCanvas<Width, Height, Type, ColorType, DisplayT, QueueSize, OrientationT>>
   {
     using BaseT = Canvas<Width, Height, Type, ColorType, UnbufferedCanvas>;
     public:
       using ColorT = typename BaseT::ColorT;
       using PixelT = typename BaseT::PixelT;
       static constexpr uint8_t PageSize = 8;
+      static constexpr bool HasWindow = HasAddressWindow<DisplayT, PixelT>::value;
+      static constexpr bool IsDithered = std::is_same_v<ColorType, Dithered>;
+      static constexpr size_t NativeWidth = OrientationT::swapsAxes ? Height : Width;
+      static constexpr size_t NativeHeight = OrientationT::swapsAxes ? Width : Height;
+      static_assert(QueueSize == 0 || HasWindow, "Merging pixels into runs requires display with address window.");
       
       /**
        * @brief Construct a new Unbuffered Canvas object
@@ -32,33 +78,188 @@ namespace EmbeddedGfx
        * @param display Reference to the display interface.
        */
       UnbufferedCanvas(DisplayT& display) : display_{display} {}
+
+      /**
+       * @brief Destroy the Unbuffered Canvas object,
+       * sending the queued pixels to the display.
+       * 
+       */
+      ~UnbufferedCanvas()
+      {
+        flush();
+      }
       
       /**
        * @brief Set the value of individual pixel.
        * 
        * @param x The x-coordinate of the pixel.
        * @param y The y-coordinate of the pixel.
-       * @param pixel The value of the pixel.
+       * @param value The encoded value of the pixel.
        */
-      void setPixel(const size_t x, const size_t y, const ColorT& pixel)
+      void setPixelRaw(const int x, const int y, const PixelT value)
       {
-        if(y < Height && x < Width)
+        if(BaseT::isInsideClip(x, y))
         {
-            display_.setPixel(x, y, pixel.getValue());
+          size_t column = static_cast<size_t>(x);
+          size_t row = static_cast<size_t>(y);
+          OrientationT::template mapPoint<Width, Height>(column, row);
+          PixelT pixel = value;
+          if constexpr(IsDithered)
+          {
+            pixel = OrderedDither::isSet(column, row, value);
+          }
+          if constexpr(QueueSize > 0)
+          {
+            queuePixel(column, row, pixel);
+          }
+          else
+          {
+            display_.setPixel(column, row, pixel);
+          }
         }
       }
 
       /**
-       * @brief Clear the canvas with a given color.
+       * @brief Send the queued run of pixels to the display.
+       * 
+       */
+      void flush()
+      {
+        if constexpr(QueueSize > 0)
+        {
+          if(queueLength_ == 0) return;
+          const size_t last = queueLength_ - 1;
+          if(queueVertical_) display_.setWindow(queueX_, queueY_, queueX_, queueY_ + last);
+          else display_.setWindow(queueX_, queueY_, queueX_ + last, queueY_);
+          display_.writePixels(queue_.data(), queueLength_);
+          queueLength_ = 0;
+        }
+      }
+
+      /**
+       * @brief Fill rectangular area of the canvas.
+       * 
+       * @param x The x-coordinate of the top-left corner.
+       * @param y The y-coordinate of the top-left corner.
+       * @param w The width of the area in pixels.
+       * @param h The height of the area in pixels.
+       * @param value The encoded value of the pixels.
+       */
+      void fillRectRaw(const int x, const int y, const int w, const int h, const PixelT value)
+      {
+        int x0 = x, y0 = y, x1 = x + w, y1 = y + h;
+        if(!BaseT::clipArea(x0, y0, x1, y1)) return;
+        OrientationT::template mapArea<Width, Height>(x0, y0, x1, y1);
+        flush();
+        fillArea(x0, y0, x1, y1, value);
+      }
+
+      /**
+       * @brief Clear the whole canvas with a given color,
+       * regardless of the clip area.
        * 
        * @param color The color to clear the canvas with.
        */
       void clear(const ColorT& color)
       {
-        display_.clear(color.getValue());
+        queueLength_ = 0;
+        if constexpr(IsDithered)
+        {
+          // the display can't clear with a pattern
+          fillArea(0, 0, static_cast<int>(NativeWidth), static_cast<int>(NativeHeight), color.getValue());
+        }
+        else
+        {
+          display_.clear(color.getValue());
+        }
       }
     private:
+      /**
+       * @brief Fill rectangular area of the display, in the native
+       * coordinates and already clipped.
+       */
+      void fillArea(const int x0, const int y0, const int x1, const int y1, const PixelT value)
+      {
+        if constexpr(HasWindow && IsDithered)
+        {
+          // the pattern differs from row to row, so the area is streamed
+          // one row at a time, the pattern of a row repeats every 8 columns
+          const size_t width = static_cast<size_t>(x1 - x0);
+          std::array<PixelT, NativeWidth> line;
+          display_.setWindow(x0, y0, x1 - 1, y1 - 1);
+          for(int row = y0; row < y1; ++row)
+          {
+            for(size_t i = 0; i < width && i < OrderedDither::Size; ++i)
+            {
+              line[i] = static_cast<PixelT>(OrderedDither::isSet(x0 + i, row, value));
+            }
+            for(size_t i = OrderedDither::Size; i < width; ++i)
+            {
+              line[i] = line[i - OrderedDither::Size];
+            }
+            display_.writePixels(line.data(), width);
+          }
+        }
+        else if constexpr(HasWindow)
+        {
+          display_.setWindow(x0, y0, x1 - 1, y1 - 1);
+          display_.fillPixels(value, static_cast<size_t>(x1 - x0) * static_cast<size_t>(y1 - y0));
+        }
+        else
+        {
+          for(int row = y0; row < y1; ++row)
+          {
+            for(int column = x0; column < x1; ++column)
+            {
+              if constexpr(IsDithered)
+              {
+                display_.setPixel(column, row, static_cast<PixelT>(OrderedDither::isSet(column, row, value)));
+              }
+              else
+              {
+                display_.setPixel(column, row, value);
+              }
+            }
+          }
+        }
+      }
+
+      /**
+       * @brief Append pixel to the queued run, or start a new run
+       * if the pixel doesn't continue the current one.
+       */
+      void queuePixel(const size_t x, const size_t y, const PixelT value)
+      {
+        if(queueLength_ > 0)
+        {
+          const bool extendsRight = (y == queueY_) && (x == queueX_ + queueLength_);
+          const bool extendsDown = (x == queueX_) && (y == queueY_ + queueLength_);
+          if(queueLength_ == 1)
+          {
+            // the second pixel decides the direction of the run
+            queueVertical_ = extendsDown;
+          }
+          const bool continuesRun = queueVertical_ ? extendsDown : extendsRight;
+          if(!continuesRun || queueLength_ == QueueSize)
+          {
+            flush();
+          }
+        }
+        if(queueLength_ == 0)
+        {
+          queueX_ = x;
+          queueY_ = y;
+          queueVertical_ = false;
+        }
+        queue_[queueLength_++] = value;
+      }
+
       DisplayT& display_;
+      std::array<PixelT, QueueSize> queue_{};
+      size_t queueX_ = 0;
+      size_t queueY_ = 0;
+      size_t queueLength_ = 0;
+      bool queueVertical_ = false;
   };
 }
 
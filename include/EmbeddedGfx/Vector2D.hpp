@@ -5,17 +5,22 @@
 #include <cmath>
 #include <type_traits>
 
+#include "Fixed.hpp"
+
 namespace EmbeddedGfx
 {
   /**
    * @brief Two dimensional vector class.
    * 
+   * All operations except abs(), angle() and unit() are constexpr,
+   * so points of static layouts can be computed at compile time.
+   * 
    * @tparam CoordinatesT Type for the coordinates of the vector.
-   * @note CoordinatesT must be arithmetic type.
+   * @note CoordinatesT must be arithmetic or fixed-point type.
    */
   template <
       typename CoordinatesT
-    , typename = typename std::enable_if_t<std::is_arithmetic_v<CoordinatesT>, CoordinatesT>
+    , typename = typename std::enable_if_t<std::is_arithmetic_v<CoordinatesT> || IsFixed<CoordinatesT>::value, CoordinatesT>
   >
   struct Vector2D
   {
@@ -27,7 +32,7 @@ namespace EmbeddedGfx
      * @param x The value for the x-coordinate.
      * @param y The value for the y-coordinate.
      */
-    Vector2D(CoordinatesT x = {}, CoordinatesT y={})
+    constexpr Vector2D(CoordinatesT x = {}, CoordinatesT y={})
       : x{x}, y{y}
     {
     }
@@ -39,7 +44,7 @@ namespace EmbeddedGfx
      * @param vector The rhs vector.
      * @return Vector2D& Reference to the lhs vector.
      */
-    Vector2D& operator+=(const Vector2D& vector)
+    constexpr Vector2D& operator+=(const Vector2D& vector)
     {
       this->x = this->x + vector.x;
       this->y = this->y + vector.y;
@@ -52,7 +57,7 @@ namespace EmbeddedGfx
      * @param vector The rhs vector.
      * @return Vector2D The resulting vector.
      */
-    Vector2D operator+(const Vector2D& vector) const
+    constexpr Vector2D operator+(const Vector2D& vector) const
     {
       Vector2D temp(*this);
       temp += vector;
@@ -66,7 +71,7 @@ namespace EmbeddedGfx
      * @param vector The rhs vector.
      * @return Vector2D& Reference to the lhs vector.
      */
-    Vector2D& operator-=(const Vector2D& vector)
+    constexpr Vector2D& operator-=(const Vector2D& vector)
     {
       this->x = this->x - vector.x;
       this->y = this->y - vector.y;
@@ -79,7 +84,7 @@ namespace EmbeddedGfx
      * @param vector The rhs vector.
      * @return Vector2D The resulting vector.
      */
-    Vector2D operator-(const Vector2D& vector) const
+    constexpr Vector2D operator-(const Vector2D& vector) const
     {
       Vector2D temp(*this);
       temp -= vector;
@@ -92,11 +97,12 @@ namespace EmbeddedGfx
      * 
      * @return Vector2D The resulting vector.
      */
-    Vector2D operator-()
+    constexpr Vector2D operator-() const
     {
       Vector2D vector;
       vector.x = -this->x;
       vector.y = -this->y;
+      return vector;
     }
 
     /**
@@ -112,7 +118,7 @@ namespace EmbeddedGfx
         typename ScalarT
       , typename = typename std::enable_if_t<std::is_arithmetic_v<ScalarT>, ScalarT>
     >
-    Vector2D& operator*=(const ScalarT scalar)
+    constexpr Vector2D& operator*=(const ScalarT scalar)
     {
       x *= scalar;
       y *= scalar;
@@ -132,7 +138,7 @@ namespace EmbeddedGfx
         typename ScalarT
       , typename = typename std::enable_if_t<std::is_arithmetic_v<ScalarT>, ScalarT>
     >
-    Vector2D operator*(const ScalarT scalar) const
+    constexpr Vector2D operator*(const ScalarT scalar) const
     {
       Vector2D temp(*this);
       temp *= scalar;
@@ -153,7 +159,7 @@ namespace EmbeddedGfx
         typename ScalarT
       , typename = typename std::enable_if_t<std::is_arithmetic_v<ScalarT>, ScalarT>
     >
-    friend Vector2D operator*(const ScalarT scalar, const Vector2D& vector)
+    friend constexpr Vector2D operator*(const ScalarT scalar, const Vector2D& vector)
     {
       return vector * scalar;
     }
@@ -171,7 +177,7 @@ namespace EmbeddedGfx
         typename ScalarT
       , typename = typename std::enable_if_t<std::is_arithmetic_v<ScalarT>, ScalarT>
     >
-    Vector2D& operator/=(const ScalarT scalar)
+    constexpr Vector2D& operator/=(const ScalarT scalar)
     {
       x /= scalar;
       y /= scalar;
@@ -191,7 +197,7 @@ namespace EmbeddedGfx
         typename ScalarT
       , typename = typename std::enable_if_t<std::is_arithmetic_v<ScalarT>, ScalarT>
     >
-    Vector2D operator/(const ScalarT scalar) const
+    constexpr Vector2D operator/(const ScalarT scalar) const
     {
       Vector2D temp(*this);
       temp /= scalar;
@@ -205,12 +211,14 @@ namespace EmbeddedGfx
      * @return true The vectors have different coordinates.
      * @return false The vectors have same coordinates.
      */
-    bool operator!=(const Vector2D& vector) const
+    constexpr bool operator!=(const Vector2D& vector) const
     {
       if constexpr (std::is_floating_point_v<CoordinatesT>)
       {
-        static constexpr float EPS = 10e-8f;
-        return (std::fabs(this->x - vector.x) >= EPS || std::fabs(this->y - vector.y) >= EPS);
+        constexpr float EPS = 10e-8f;
+        const CoordinatesT dx = this->x - vector.x;
+        const CoordinatesT dy = this->y - vector.y;
+        return (dx >= EPS || dx <= -EPS || dy >= EPS || dy <= -EPS);
       }
       else
       {
@@ -225,7 +233,7 @@ namespace EmbeddedGfx
      * @return true The vectors have same coordinates.
      * @return false The vectors have different coordinates.
      */
-    bool operator==(const Vector2D& vector) const
+    constexpr bool operator==(const Vector2D& vector) const
     {
       return !(*this != vector);
     }
@@ -255,13 +263,18 @@ namespace EmbeddedGfx
      * 
      * @return Vector2D Vector with rounded coordinates.
      */
-    Vector2D rounded() const
+    constexpr Vector2D rounded() const
     {
       Vector2D vector(*this);
       if constexpr (std::is_floating_point_v<CoordinatesT>)
       {
-        vector.x = std::round(vector.x);
-        vector.y = std::round(vector.y);
+        vector.x = static_cast<CoordinatesT>(roundFloating<long long>(vector.x));
+        vector.y = static_cast<CoordinatesT>(roundFloating<long long>(vector.y));
+      }
+      else if constexpr (IsFixed<CoordinatesT>::value)
+      {
+        vector.x = vector.x.round();
+        vector.y = vector.y.round();
       }
       return vector;
     }
@@ -282,6 +295,7 @@ namespace EmbeddedGfx
   // aliases
   using Vector2Df = Vector2D<float>;
   using Vector2Di = Vector2D<int>;
+  using Vector2Dq = Vector2D<Q24_8>;
 }
 
 
@@ -0,0 +1,405 @@
+/**
+ * @brief Host tool converting BDF bitmap font into header with constexpr
+ * tables of EmbeddedGfx::ProportionalFont.
+ * 
+ * Usage: embedded-gfx-font-compiler <font.bdf> -o <Name.hpp> --name <Name>
+ *        [--first <code>] [--last <code>] [--fallback <code>] [--kerning <file>]
+ * 
+ * The kerning file has one pair per line, the two characters and the
+ * adjustment in pixels, for example "7 . -2". The characters can be also
+ * given by their codes, like 0x20. The lines starting with # are ignored.
+ */
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+  /**
+   * @brief Glyph as read from the BDF file.
+   * 
+   */
+  struct BdfGlyph
+  {
+    int encoding = -1;
+    int advance = 0;
+    int width = 0;
+    int height = 0;
+    int offsetX = 0;
+    int offsetY = 0;
+    /// The rows of the bitmap from the top, the leftmost pixel in the MSB of the first byte.
+    std::vector<std::vector<uint8_t>> rows;
+
+    bool isSet(const int x, const int y) const
+    {
+      return (rows[y][x / 8] >> (7 - x % 8)) & 1;
+    }
+  };
+
+  struct BdfFont
+  {
+    std::string name;
+    int ascent = 0;
+    int descent = 0;
+    int defaultChar = -1;
+    std::map<int, BdfGlyph> glyphs;
+  };
+
+  /**
+   * @brief Glyph converted to the pages of the font height.
+   * 
+   */
+  struct OutputGlyph
+  {
+    std::vector<uint8_t> bitmap;
+    int width = 0;
+    int left = 0;
+    int advance = 0;
+  };
+
+  struct Kerning
+  {
+    int left;
+    int right;
+    int adjust;
+  };
+
+  struct Options
+  {
+    std::string input;
+    std::string output;
+    std::string name;
+    std::string kerning;
+    int first = 32;
+    int last = 126;
+    int fallback = -1;
+  };
+
+  [[noreturn]] void fail(const std::string& message)
+  {
+    std::cerr << "embedded-gfx-font-compiler: error: " << message << std::endl;
+    std::exit(1);
+  }
+
+  int parseCode(const std::string& text)
+  {
+    char* end = nullptr;
+    const long value = std::strtol(text.c_str(), &end, 0);
+    if(text.empty() || *end != '\0' || value < 0 || value > 255)
+    {
+      fail("invalid character code '" + text + "'");
+    }
+    return static_cast<int>(value);
+  }
+
+  Options parseOptions(const int argc, char** argv)
+  {
+    Options options;
+    for(int i = 1; i < argc; ++i)
+    {
+      const std::string arg = argv[i];
+      const auto value = [&]() -> std::string {
+        if(i + 1 == argc) fail("missing value of " + arg);
+        return argv[++i];
+      };
+      if(arg == "-o") options.output = value();
+      else if(arg == "--name") options.name = value();
+      else if(arg == "--first") options.first = parseCode(value());
+      else if(arg == "--last") options.last = parseCode(value());
+      else if(arg == "--fallback") options.fallback = parseCode(value());
+      else if(arg == "--kerning") options.kerning = value();
+      else if(!arg.empty() && arg[0] == '-') fail("unknown option " + arg);
+      else options.input = arg;
+    }
+    if(options.input.empty() || options.output.empty() || options.name.empty())
+    {
+      fail("usage: embedded-gfx-font-compiler <font.bdf> -o <Name.hpp> --name <Name>"
+           " [--first <code>] [--last <code>] [--fallback <code>] [--kerning <file>]");
+    }
+    if(options.first > options.last) fail("the first character is after the last one");
+    return options;
+  }
+
+  std::vector<uint8_t> parseHexRow(const std::string& line, const int width)
+  {
+    std::vector<uint8_t> row((width + 7) / 8, 0);
+    if(line.size() < row.size() * 2) fail("short bitmap row '" + line + "'");
+    for(size_t i = 0; i < row.size(); ++i)
+    {
+      row[i] = static_cast<uint8_t>(std::stoul(line.substr(i * 2, 2), nullptr, 16));
+    }
+    return row;
+  }
+
+  BdfFont readBdf(const std::string& path)
+  {
+    std::ifstream file(path);
+    if(!file) fail("cannot open " + path);
+    BdfFont font;
+    int boxHeight = 0;
+    int boxOffsetY = 0;
+    BdfGlyph glyph;
+    std::string line;
+    while(std::getline(file, line))
+    {
+      std::istringstream tokens(line);
+      std::string keyword;
+      tokens >> keyword;
+      if(keyword == "FONT") std::getline(tokens >> std::ws, font.name);
+      else if(keyword == "FONTBOUNDINGBOX")
+      {
+        int boxWidth = 0, boxOffsetX = 0;
+        tokens >> boxWidth >> boxHeight >> boxOffsetX >> boxOffsetY;
+      }
+      else if(keyword == "FONT_ASCENT") tokens >> font.ascent;
+      else if(keyword == "FONT_DESCENT") tokens >> font.descent;
+      else if(keyword == "DEFAULT_CHAR") tokens >> font.defaultChar;
+      else if(keyword == "STARTCHAR") glyph = BdfGlyph{};
+      else if(keyword == "ENCODING") tokens >> glyph.encoding;
+      else if(keyword == "DWIDTH") tokens >> glyph.advance;
+      else if(keyword == "BBX") tokens >> glyph.width >> glyph.height >> glyph.offsetX >> glyph.offsetY;
+      else if(keyword == "BITMAP")
+      {
+        for(int row = 0; row < glyph.height; ++row)
+        {
+          if(!std::getline(file, line)) fail("unexpected end of " + path);
+          glyph.rows.push_back(parseHexRow(line, glyph.width));
+        }
+      }
+      else if(keyword == "ENDCHAR")
+      {
+        // only the 8-bit codes can be stored in char strings
+        if(glyph.encoding >= 0 && glyph.encoding <= 255) font.glyphs[glyph.encoding] = glyph;
+      }
+    }
+    // the fonts without the properties use the bounding box of the font
+    if(font.ascent == 0 && font.descent == 0)
+    {
+      font.ascent = boxHeight + boxOffsetY;
+      font.descent = -boxOffsetY;
+    }
+    if(font.glyphs.empty()) fail("no glyphs in " + path);
+    return font;
+  }
+
+  OutputGlyph convertGlyph(const BdfFont& font, const BdfGlyph& glyph, const int height)
+  {
+    // the columns without pixels are not stored, only the left offset moves
+    int minX = glyph.width;
+    int maxX = -1;
+    for(int y = 0; y < glyph.height; ++y)
+    {
+      for(int x = 0; x < glyph.width; ++x)
+      {
+        if(glyph.isSet(x, y))
+        {
+          minX = std::min(minX, x);
+          maxX = std::max(maxX, x);
+        }
+      }
+    }
+    OutputGlyph output;
+    output.advance = glyph.advance;
+    if(maxX < 0) return output;
+    output.width = maxX - minX + 1;
+    output.left = glyph.offsetX + minX;
+    const int pages = (height + 7) / 8;
+    output.bitmap.assign(static_cast<size_t>(pages * output.width), 0);
+    // the row of the top of the glyph bounding box, from the top of the font
+    const int top = font.ascent - (glyph.offsetY + glyph.height);
+    for(int y = 0; y < glyph.height; ++y)
+    {
+      const int row = top + y;
+      for(int x = minX; x <= maxX; ++x)
+      {
+        if(!glyph.isSet(x, y)) continue;
+        if(row < 0 || row >= height)
+        {
+          std::cerr << "embedded-gfx-font-compiler: warning: glyph " << glyph.encoding
+                    << " exceeds the font ascent or descent, the pixel is dropped" << std::endl;
+          continue;
+        }
+        output.bitmap[(row / 8) * output.width + (x - minX)] |= static_cast<uint8_t>(1 << (row % 8));
+      }
+    }
+    return output;
+  }
+
+  std::vector<Kerning> readKerning(const std::string& path)
+  {
+    std::vector<Kerning> pairs;
+    if(path.empty()) return pairs;
+    std::ifstream file(path);
+    if(!file) fail("cannot open " + path);
+    std::string line;
+    while(std::getline(file, line))
+    {
+      std::istringstream tokens(line);
+      std::string left, right;
+      int adjust = 0;
+      if(!(tokens >> left) || left[0] == '#') continue;
+      if(!(tokens >> right >> adjust)) fail("invalid kerning pair '" + line + "'");
+      const auto code = [](const std::string& text) {
+        return (text.size() == 1) ? static_cast<int>(static_cast<uint8_t>(text[0])) : parseCode(text);
+      };
+      if(adjust < -128 || adjust > 127) fail("kerning out of range '" + line + "'");
+      pairs.push_back({code(left), code(right), adjust});
+    }
+    // the font looks the pairs up by binary search
+    std::sort(pairs.begin(), pairs.end(), [](const Kerning& a, const Kerning& b) {
+      return (a.left != b.left) ? (a.left < b.left) : (a.right < b.right);
+    });
+    return pairs;
+  }
+
+  std::string describe(const int code)
+  {
+    std::ostringstream text;
+    if(code >= 32 && code < 127 && code != '\\' && code != '\'') text << "'" << static_cast<char>(code) << "'";
+    else text << "0x" << std::hex << std::setw(2) << std::setfill('0') << code;
+    return text.str();
+  }
+
+  std::string baseName(const std::string& path)
+  {
+    const size_t slash = path.find_last_of("/\\");
+    return (slash == std::string::npos) ? path : path.substr(slash + 1);
+  }
+
+  void writeHeader(const Options& options, const BdfFont& font, const int height
+                 , const std::vector<int>& glyphCodes, const std::vector<OutputGlyph>& glyphs
+                 , const std::vector<size_t>& offsets, const std::vector<uint8_t>& bitmaps
+                 , const int fallback, const std::vector<Kerning>& kerning)
+  {
+    std::ofstream file(options.output);
+    if(!file) fail("cannot write " + options.output);
+    std::string guard = "EMBEDDED_GFX_FONTS_" + options.name + "_HPP";
+    std::transform(guard.begin(), guard.end(), guard.begin(), [](const unsigned char c) {
+      return std::isalnum(c) ? static_cast<char>(std::toupper(c)) : '_';
+    });
+    file << "// Generated by embedded-gfx-font-compiler from " << baseName(options.input) << ", do not edit.\n"
+         << "#ifndef " << guard << "\n"
+         << "#define " << guard << "\n\n"
+         << "#include <array>\n"
+         << "#include <cstdint>\n\n"
+         << "#include <EmbeddedGfx/ProportionalFont.hpp>\n\n"
+         << "namespace EmbeddedGfx::Fonts\n"
+         << "{\n"
+         << "  struct " << options.name << "Data\n"
+         << "  {\n"
+         << "    static constexpr uint8_t height = " << height << ";\n"
+         << "    static constexpr uint8_t first = " << options.first << ";\n"
+         << "    static constexpr uint8_t last = " << options.last << ";\n"
+         << "    static constexpr uint8_t fallback = " << fallback << ";\n";
+
+    file << "    static constexpr std::array<uint8_t, " << bitmaps.size() << "> bitmaps{{\n";
+    size_t written = 0;
+    for(size_t i = 0; i < glyphs.size(); ++i)
+    {
+      // the glyphs with the same bitmap share it
+      if(glyphs[i].bitmap.empty() || offsets[i] != written) continue;
+      written += glyphs[i].bitmap.size();
+      file << "     ";
+      for(const uint8_t byte: glyphs[i].bitmap)
+      {
+        file << " 0x" << std::hex << std::setw(2) << std::setfill('0') << static_cast<int>(byte) << std::dec << ",";
+      }
+      file << " // " << describe(glyphCodes[i]) << "\n";
+    }
+    file << "    }};\n";
+
+    file << "    static constexpr std::array<GlyphEntry, " << glyphs.size() << "> glyphs{{\n";
+    for(size_t i = 0; i < glyphs.size(); ++i)
+    {
+      file << "      {" << offsets[i] << ", " << glyphs[i].width << ", " << glyphs[i].left
+           << ", " << glyphs[i].advance << "}, // " << describe(options.first + static_cast<int>(i)) << "\n";
+    }
+    file << "    }};\n";
+
+    file << "    static constexpr std::array<KerningPair, " << kerning.size() << "> kerning{{\n";
+    for(const Kerning& pair: kerning)
+    {
+      file << "      {" << pair.left << ", " << pair.right << ", " << pair.adjust << "}, // "
+           << describe(pair.left) << " " << describe(pair.right) << "\n";
+    }
+    file << "    }};\n"
+         << "  };\n\n"
+         << "  /// " << (font.name.empty() ? options.name : font.name) << ", " << height << " pixels high.\n"
+         << "  using " << options.name << " = ProportionalFont<" << options.name << "Data>;\n"
+         << "}\n\n"
+         << "#endif // " << guard << "\n";
+  }
+}
+
+int main(int argc, char** argv)
+{
+  const Options options = parseOptions(argc, argv);
+  const BdfFont font = readBdf(options.input);
+  const int height = font.ascent + font.descent;
+  if(height <= 0 || height > 255) fail("font height must be 1 to 255 pixels");
+
+  // the characters outside of the range, and the missing ones, use the fallback glyph
+  int fallbackCode = options.fallback;
+  for(const int candidate: {font.defaultChar, static_cast<int>('?'), static_cast<int>(' ')})
+  {
+    if(fallbackCode < 0 && candidate >= options.first && candidate <= options.last && font.glyphs.count(candidate))
+    {
+      fallbackCode = candidate;
+    }
+  }
+  if(fallbackCode < 0)
+  {
+    const auto inRange = font.glyphs.lower_bound(options.first);
+    if(inRange == font.glyphs.end() || inRange->first > options.last) fail("no glyphs in the range of characters");
+    fallbackCode = inRange->first;
+  }
+  if(fallbackCode < options.first || fallbackCode > options.last || !font.glyphs.count(fallbackCode))
+  {
+    fail("the fallback character " + describe(fallbackCode) + " is not in the font");
+  }
+
+  std::vector<int> glyphCodes;
+  std::vector<OutputGlyph> glyphs;
+  for(int code = options.first; code <= options.last; ++code)
+  {
+    const auto found = font.glyphs.find(code);
+    const int source = (found != font.glyphs.end()) ? code : fallbackCode;
+    const OutputGlyph glyph = convertGlyph(font, font.glyphs.at(source), height);
+    if(glyph.left < -128 || glyph.left > 127 || glyph.advance < 0 || glyph.advance > 255)
+    {
+      fail("metrics of glyph " + describe(source) + " out of range");
+    }
+    glyphCodes.push_back(source);
+    glyphs.push_back(glyph);
+  }
+
+  // the identical bitmaps, like of the missing characters, are stored once
+  std::vector<uint8_t> bitmaps;
+  std::vector<size_t> offsets;
+  std::map<std::vector<uint8_t>, size_t> stored;
+  for(const OutputGlyph& glyph: glyphs)
+  {
+    const auto found = stored.find(glyph.bitmap);
+    if(found != stored.end())
+    {
+      offsets.push_back(found->second);
+      continue;
+    }
+    offsets.push_back(bitmaps.size());
+    stored[glyph.bitmap] = bitmaps.size();
+    bitmaps.insert(bitmaps.end(), glyph.bitmap.begin(), glyph.bitmap.end());
+  }
+  if(bitmaps.size() > UINT16_MAX) fail("the bitmaps don't fit in 64 KiB, reduce the range of characters");
+
+  const std::vector<Kerning> kerning = readKerning(options.kerning);
+  writeHeader(options, font, height, glyphCodes, glyphs, offsets, bitmaps, fallbackCode - options.first, kerning);
+  return 0;
+}